@@ -12,6 +12,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "cppgc/common.h"
 #include "cppgc/macros.h"
@@ -884,6 +885,14 @@ class V8_EXPORT Isolate {
    */
   void SetMemorySaverMode(bool memory_saver_mode_enabled);
 
+  /**
+   * Optional request from the embedder to bound the time spent evacuating
+   * fragmented old generation pages in a single garbage collection pause if
+   * `enabled` is true. Compaction is then spread over several garbage
+   * collections, trading slower defragmentation for shorter pauses.
+   */
+  void SetIncrementalCompactionEnabled(bool enabled);
+
   /**
    * Drop non-essential caches. Should only be called from testing code.
    * The method can potentially block for a long time and does not necessarily
@@ -1052,6 +1061,44 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about code caches consumed in this isolate.
+   *
+   * \param code_cache_statistics The CodeCacheStatistics object to fill in
+   *   the number of accepted and rejected code caches.
+   * \returns true on success.
+   */
+  bool GetCodeCacheStatistics(CodeCacheStatistics* code_cache_statistics);
+
+  /**
+   * Get the timings of the phases of creating this isolate and its contexts,
+   * such as startup deserialization and the first script compile.
+   *
+   * \param startup_statistics The StartupStatistics object to fill in.
+   * \returns true on success.
+   */
+  bool GetStartupStatistics(StartupStatistics* startup_statistics);
+
+  /**
+   * Serializes the type feedback and tiering decisions collected for the
+   * functions of this isolate into a profile, see LoadFeedbackProfile.
+   * Functions are identified by a hash of their script's source and their
+   * position in it. Feedback that refers to heap objects, such as the maps
+   * seen by property accesses or the targets of calls, is not included.
+   */
+  std::vector<uint8_t> CreateFeedbackProfile();
+
+  /**
+   * Loads a profile created by CreateFeedbackProfile, typically in a previous
+   * run of the same application. Functions compiled afterwards from the same
+   * sources start with the profiled feedback and tiering decisions instead of
+   * collecting them again. Replaces any previously loaded profile.
+   *
+   * \returns false if the profile is malformed or was created by a different
+   *   version of V8.
+   */
+  bool LoadFeedbackProfile(const uint8_t* data, size_t length);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -125,6 +125,9 @@ struct GarbageCollectionYoungCycle {
   double collection_rate_cpp_in_percent = -1.0;
   double efficiency_cpp_in_bytes_per_us = -1.0;
   double main_thread_efficiency_cpp_in_bytes_per_us = -1.0;
+  int64_t remembered_slots_cpp = -1;
+  int64_t remembered_source_objects_cpp = -1;
+  double survival_rate_cpp = -1.0;
 #endif  // defined(CPPGC_YOUNG_GENERATION)
 };
 
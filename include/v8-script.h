@@ -796,6 +796,16 @@ class V8_EXPORT ScriptCompiler {
      */
     void MergeWithExistingScript();
 
+    /**
+     * Performs part of the main-thread work of merging into an existing
+     * script, handling at most `max_functions` functions. Returns true once no
+     * merge work is left for compiling the script. Embedders can use this to
+     * split the main-thread work for large caches into short steps. May be
+     * called only after MergeWithExistingScript() has completed, on a thread
+     * where the Isolate is currently entered.
+     */
+    bool ContinueMergeInForeground(Isolate* isolate, int max_functions);
+
    private:
     friend class ScriptCompiler;
 
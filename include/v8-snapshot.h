@@ -8,6 +8,7 @@
 #include "v8-internal.h"      // NOLINT(build/include_directory)
 #include "v8-isolate.h"       // NOLINT(build/include_directory)
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
@@ -134,7 +135,14 @@ struct DeserializeAPIWrapperCallback {
  */
 class V8_EXPORT SnapshotCreator {
  public:
-  enum class FunctionCodeHandling { kClear, kKeep };
+  /**
+   * kClear discards compiled code. kKeep keeps bytecode but discards type
+   * feedback. kKeepWithFeedback also keeps the type feedback and invocation
+   * counts of compiled functions, so that functions which were hot while the
+   * snapshot was created tier up soon after deserialization. Optimized code
+   * itself is never serialized, it is regenerated from the feedback.
+   */
+  enum class FunctionCodeHandling { kClear, kKeep, kKeepWithFeedback };
 
   /**
    * Initialize and enter an isolate, and set it up for serialization.
@@ -265,11 +273,29 @@ class V8_EXPORT SnapshotCreator {
   template <class T>
   V8_INLINE size_t AddData(Local<T> object);
 
+  /**
+   * Deeply freeze the object, i.e. freeze it and all objects reachable through
+   * its own data properties except for functions, and mark the object graph
+   * for promotion to read only space when the snapshot blob is created.
+   * Promoted objects are shared by all isolates created from the snapshot and
+   * are not visited by the garbage collector. Currently the elements of
+   * frozen arrays are promoted if they only contain numbers and objects that
+   * are already in read only space.
+   *
+   * Promotion only happens if read only space can still be extended, see
+   * --extensible-ro-snapshot.
+   *
+   * This is an experimental feature and may still change significantly.
+   * \returns Nothing if freezing threw an exception.
+   */
+  Maybe<bool> FreezeAndPrepareForPromotionToReadOnly(Local<Context> context,
+                                                     Local<Object> object);
+
   /**
    * Created a snapshot data blob.
    * This must not be called from within a handle scope.
    * \param function_code_handling whether to include compiled function code
-   *        in the snapshot.
+   *        and type feedback in the snapshot.
    * \returns { nullptr, 0 } on failure, and a startup snapshot on success. The
    *        caller acquires ownership of the data array in the return value.
    */
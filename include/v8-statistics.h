@@ -197,12 +197,29 @@ class V8_EXPORT HeapSpaceStatistics {
   size_t space_available_size() { return space_available_size_; }
   size_t physical_space_size() { return physical_space_size_; }
 
+  static constexpr size_t kFragmentationHistogramBuckets = 10;
+
+  /**
+   * Returns the number of pages in this space whose fragmentation falls into
+   * `bucket`, as observed at the start of the last full garbage collection
+   * that considered compaction. Bucket `i` holds pages where
+   * [i * 10, (i + 1) * 10) percent of the page is free memory that is only
+   * usable for small allocations. The last bucket also holds fully fragmented
+   * pages. Only populated for paged spaces.
+   */
+  size_t fragmentation_histogram(size_t bucket) {
+    return bucket < kFragmentationHistogramBuckets
+               ? fragmentation_histogram_[bucket]
+               : 0;
+  }
+
  private:
   const char* space_name_;
   size_t space_size_;
   size_t space_used_size_;
   size_t space_available_size_;
   size_t physical_space_size_;
+  size_t fragmentation_histogram_[kFragmentationHistogramBuckets];
 
   friend class Isolate;
 };
@@ -241,6 +258,84 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Results of consuming code caches in an isolate, see
+ * Isolate::GetCodeCacheStatistics.
+ */
+class V8_EXPORT CodeCacheStatistics {
+ public:
+  CodeCacheStatistics();
+  /** Number of code caches that were accepted. */
+  size_t accepted_count() { return accepted_count_; }
+  /**
+   * Number of accepted code caches that were produced with different flags,
+   * none of which can affect the cached data.
+   */
+  size_t accepted_with_flags_mismatch_count() {
+    return accepted_with_flags_mismatch_count_;
+  }
+  /**
+   * Number of code caches that were rejected for the given
+   * ScriptCompiler::CachedData::CompatibilityCheckResult.
+   */
+  size_t rejected_count(int reason) {
+    if (reason < 0 || reason >= kMaxRejectReasons) return 0;
+    return rejected_counts_[reason];
+  }
+
+ private:
+  static constexpr int kMaxRejectReasons = 16;
+
+  size_t accepted_count_;
+  size_t accepted_with_flags_mismatch_count_;
+  size_t rejected_counts_[kMaxRejectReasons];
+
+  friend class Isolate;
+};
+
+/**
+ * Timings of the phases of creating an isolate and its contexts, see
+ * Isolate::GetStartupStatistics. Phases are ordered by the time they ended and
+ * may nest, e.g. embedder field callbacks run during context deserialization.
+ * A phase that happens more than once, such as context deserialization, has an
+ * entry for each occurrence.
+ */
+class V8_EXPORT StartupStatistics {
+ public:
+  StartupStatistics();
+  /** Number of recorded phases. */
+  size_t phase_count() { return phase_count_; }
+  /**
+   * Name of the phase at the given index, which is also the name of the trace
+   * event emitted for it, e.g. "V8.StartupContextDeserialization".
+   */
+  const char* phase_name(size_t index) {
+    return index < phase_count_ ? phases_[index].name : nullptr;
+  }
+  /** Start of the phase in milliseconds after the isolate was allocated. */
+  double phase_start_ms(size_t index) {
+    return index < phase_count_ ? phases_[index].start_ms : 0;
+  }
+  /** Duration of the phase in milliseconds. */
+  double phase_duration_ms(size_t index) {
+    return index < phase_count_ ? phases_[index].duration_ms : 0;
+  }
+
+ private:
+  static constexpr size_t kMaxPhases = 32;
+
+  struct Phase {
+    const char* name;
+    double start_ms;
+    double duration_ms;
+  };
+
+  size_t phase_count_;
+  Phase phases_[kMaxPhases];
+
+  friend class Isolate;
+};
+
 }  // namespace v8
 
 #endif  // INCLUDE_V8_STATISTICS_H_
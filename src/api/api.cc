@@ -63,6 +63,7 @@
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/embedder-state.h"
 #include "src/execution/execution.h"
+#include "src/execution/feedback-profile.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/messages.h"
@@ -447,6 +448,15 @@ size_t SnapshotCreator::AddData(Local<Context> context, i::Address object) {
   return impl_->AddData(Utils::OpenDirectHandle(*context), object);
 }
 
+Maybe<bool> SnapshotCreator::FreezeAndPrepareForPromotionToReadOnly(
+    Local<Context> context, Local<Object> object) {
+  i::Isolate* i_isolate = impl_->isolate();
+  EnterV8Scope<> api_scope{i_isolate, context,
+                           RCCId::kAPI_SnapshotCreator_FreezeForPromotion};
+  return impl_->FreezeAndPrepareForPromotionToReadOnly(
+      Utils::OpenDirectHandle(*object));
+}
+
 StartupData SnapshotCreator::CreateBlob(
     SnapshotCreator::FunctionCodeHandling function_code_handling) {
   return impl_->CreateBlob(function_code_handling);
@@ -2878,6 +2888,19 @@ void ScriptCompiler::ConsumeCodeCacheTask::MergeWithExistingScript() {
   impl_->MergeWithExistingScript();
 }
 
+bool ScriptCompiler::ConsumeCodeCacheTask::ContinueMergeInForeground(
+    Isolate* v8_isolate, int max_functions) {
+  Utils::ApiCheck(max_functions > 0,
+                  "v8::ScriptCompiler::ConsumeCodeCacheTask::"
+                  "ContinueMergeInForeground",
+                  "max_functions must be positive");
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  i::DisallowJavascriptExecutionDebugOnly no_execution(i_isolate);
+  i::DisallowExceptionsDebugOnly no_exceptions(i_isolate);
+  return impl_->ContinueMergeInForeground(i_isolate,
+                                          static_cast<uint32_t>(max_functions));
+}
+
 ScriptCompiler::ConsumeCodeCacheTask* ScriptCompiler::StartConsumingCodeCache(
     Isolate* v8_isolate, std::unique_ptr<CachedData> cached_data) {
   if (!i::v8_flags.concurrent_cache_deserialization) return nullptr;
@@ -2958,8 +2981,13 @@ MaybeLocal<Module> ScriptCompiler::CompileModule(
 }
 
 uint32_t ScriptCompiler::CachedDataVersionTag() {
-  return static_cast<uint32_t>(base::hash_combine(internal::Version::Hash(),
-                                                  internal::FlagList::Hash()));
+  // Flags that cannot affect the cached data don't invalidate code caches, so
+  // they don't change the tag either.
+  uint32_t flag_hash = internal::v8_flags.code_cache_relaxed_flag_check
+                           ? internal::FlagList::CodeCacheHash()
+                           : internal::FlagList::Hash();
+  return static_cast<uint32_t>(
+      base::hash_combine(internal::Version::Hash(), flag_hash));
 }
 
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
@@ -6601,7 +6629,8 @@ HeapSpaceStatistics::HeapSpaceStatistics()
       space_size_(0),
       space_used_size_(0),
       space_available_size_(0),
-      physical_space_size_(0) {}
+      physical_space_size_(0),
+      fragmentation_histogram_{} {}
 
 HeapObjectStatistics::HeapObjectStatistics()
     : object_type_(nullptr),
@@ -6615,6 +6644,13 @@ HeapCodeStatistics::HeapCodeStatistics()
       external_script_source_size_(0),
       cpu_profiler_metadata_size_(0) {}
 
+CodeCacheStatistics::CodeCacheStatistics()
+    : accepted_count_(0),
+      accepted_with_flags_mismatch_count_(0),
+      rejected_counts_{} {}
+
+StartupStatistics::StartupStatistics() : phase_count_(0), phases_{} {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -10590,6 +10626,15 @@ bool Isolate::GetHeapSpaceStatistics(HeapSpaceStatistics* space_statistics,
     space_statistics->space_available_size_ = space ? space->Available() : 0;
     space_statistics->physical_space_size_ =
         space ? space->CommittedPhysicalMemory() : 0;
+    if (space && allocation_space >= i::FIRST_GROWABLE_PAGED_SPACE &&
+        allocation_space <= i::LAST_GROWABLE_PAGED_SPACE) {
+      static_assert(HeapSpaceStatistics::kFragmentationHistogramBuckets ==
+                    i::PagedSpaceBase::kFragmentationHistogramBuckets);
+      const i::PagedSpaceBase::FragmentationHistogram& histogram =
+          heap->paged_space(allocation_space)->fragmentation_histogram();
+      std::copy(histogram.begin(), histogram.end(),
+                space_statistics->fragmentation_histogram_);
+    }
   }
   return true;
 }
@@ -10650,6 +10695,55 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetCodeCacheStatistics(
+    CodeCacheStatistics* code_cache_statistics) {
+  if (!code_cache_statistics) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  code_cache_statistics->accepted_count_ =
+      i_isolate->code_cache_accepted_count();
+  code_cache_statistics->accepted_with_flags_mismatch_count_ =
+      i_isolate->code_cache_accepted_with_flags_mismatch_count();
+  static_assert(i::Isolate::kCodeCacheRejectReasonCount <=
+                CodeCacheStatistics::kMaxRejectReasons);
+  for (int i = 0; i < i::Isolate::kCodeCacheRejectReasonCount; i++) {
+    code_cache_statistics->rejected_counts_[i] =
+        i_isolate->code_cache_reject_counts()[i];
+  }
+  return true;
+}
+
+bool Isolate::GetStartupStatistics(StartupStatistics* startup_statistics) {
+  if (!startup_statistics) return false;
+
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  const i::StartupTimeline* timeline = i_isolate->startup_timeline();
+  static_assert(i::StartupTimeline::kMaxEvents <=
+                StartupStatistics::kMaxPhases);
+  startup_statistics->phase_count_ = timeline->event_count();
+  for (size_t i = 0; i < timeline->event_count(); i++) {
+    const i::StartupTimeline::Event& event = timeline->event(i);
+    startup_statistics->phases_[i] = {
+        i::StartupTimeline::PhaseName(event.phase),
+        event.start.InMillisecondsF(), event.duration.InMillisecondsF()};
+  }
+  return true;
+}
+
+std::vector<uint8_t> Isolate::CreateFeedbackProfile() {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  return i::FeedbackProfile::Serialize(i_isolate);
+}
+
+bool Isolate::LoadFeedbackProfile(const uint8_t* data, size_t length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  std::unique_ptr<i::FeedbackProfile> profile =
+      i::FeedbackProfile::Deserialize(base::VectorOf(data, length));
+  if (!profile) return false;
+  i_isolate->set_feedback_profile(std::move(profile));
+  return true;
+}
+
 bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
                             MeasureMemoryExecution execution) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
@@ -10893,6 +10987,11 @@ void Isolate::SetMemorySaverMode(bool memory_saver_mode_enabled) {
   i_isolate->set_memory_saver_mode_enabled(memory_saver_mode_enabled);
 }
 
+void Isolate::SetIncrementalCompactionEnabled(bool enabled) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
+  i_isolate->heap()->set_incremental_compaction_enabled(enabled);
+}
+
 void Isolate::ClearCachesForTesting() {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(this);
   i_isolate->AbortConcurrentOptimization(i::BlockingBehavior::kBlock);
@@ -36,6 +36,7 @@
 #include <cstdio>
 #include <memory>
 #include <optional>
+#include <string>
 
 #include "src/base/logging.h"
 #include "src/base/memory.h"
@@ -226,6 +227,92 @@ std::vector<OS::SharedLibraryAddress> OS::GetSharedLibraryAddresses() {
   return ::v8::base::GetSharedLibraryAddresses(nullptr);
 }
 
+namespace {
+
+std::optional<std::string> ReadFirstLine(const std::string& path) {
+  FILE* file = fopen(path.c_str(), "r");
+  if (file == nullptr) return std::nullopt;
+  char buffer[256];
+  const bool success = fgets(buffer, sizeof(buffer), file) != nullptr;
+  fclose(file);
+  if (!success) return std::nullopt;
+  std::string line(buffer);
+  if (!line.empty() && line.back() == '\n') line.pop_back();
+  return line;
+}
+
+std::optional<uint64_t> ReadCgroupValue(const std::string& path) {
+  std::optional<std::string> line = ReadFirstLine(path);
+  // "max" denotes the absence of a limit.
+  if (!line || *line == "max") return std::nullopt;
+  char* end = nullptr;
+  const uint64_t value = strtoull(line->c_str(), &end, 10);
+  if (end == line->c_str()) return std::nullopt;
+  return value;
+}
+
+// Parses the "some avg10=..." line of a pressure stall information file.
+std::optional<double> ReadMemoryStallPercent(const std::string& path) {
+  std::optional<std::string> line = ReadFirstLine(path);
+  if (!line) return std::nullopt;
+  double avg10 = 0;
+  if (sscanf(line->c_str(), "some avg10=%lf", &avg10) != 1) {
+    return std::nullopt;
+  }
+  return avg10;
+}
+
+// Returns the path of the cgroup v2 hierarchy of the process, e.g. "/a/b".
+std::optional<std::string> ReadCgroupPath(const std::string& proc_root) {
+  FILE* file = fopen((proc_root + "/self/cgroup").c_str(), "r");
+  if (file == nullptr) return std::nullopt;
+  std::optional<std::string> result;
+  char buffer[512];
+  while (fgets(buffer, sizeof(buffer), file) != nullptr) {
+    // The unified hierarchy has the entry "0::<path>".
+    if (strncmp(buffer, "0::", 3) != 0) continue;
+    std::string path(buffer + 3);
+    if (!path.empty() && path.back() == '\n') path.pop_back();
+    if (path.empty() || path[0] != '/') break;
+    if (path == "/") path.clear();
+    result = path;
+    break;
+  }
+  fclose(file);
+  return result;
+}
+
+}  // namespace
+
+OS::ContainerMemoryInfo ReadContainerMemoryInfo(const std::string& cgroup_root,
+                                                const std::string& proc_root) {
+  OS::ContainerMemoryInfo info;
+  std::optional<std::string> cgroup_path = ReadCgroupPath(proc_root);
+  if (!cgroup_path) return info;
+
+  const std::string cgroup_dir = cgroup_root + *cgroup_path;
+  // Limits of ancestors apply as well. The root cgroup has no limit.
+  for (std::string path = *cgroup_path; !path.empty();
+       path = path.substr(0, path.rfind('/'))) {
+    std::optional<uint64_t> limit =
+        ReadCgroupValue(cgroup_root + path + "/memory.max");
+    if (limit && (!info.limit || *limit < *info.limit)) info.limit = limit;
+  }
+  info.usage = ReadCgroupValue(cgroup_dir + "/memory.current");
+  info.stall_percent = ReadMemoryStallPercent(cgroup_dir + "/memory.pressure");
+  if (!info.stall_percent) {
+    // Fall back to system-wide pressure if the cgroup does not report it.
+    info.stall_percent =
+        ReadMemoryStallPercent(proc_root + "/pressure/memory");
+  }
+  return info;
+}
+
+// static
+OS::ContainerMemoryInfo OS::GetContainerMemoryInfo() {
+  return ::v8::base::ReadContainerMemoryInfo("/sys/fs/cgroup", "/proc");
+}
+
 // static
 bool OS::RemapPages(const void* address, size_t size, void* new_address,
                     MemoryPermission access) {
@@ -310,6 +397,70 @@ bool OS::RemapPages(const void* address, size_t size, void* new_address,
   return true;
 }
 
+// static
+std::optional<SharedMemoryHandle> OS::CreateSharedMemoryHandle(
+    size_t size, const char* name) {
+#if defined(__NR_memfd_create)
+  // Use the raw syscall, older libcs do not have a memfd_create() wrapper.
+  int fd = static_cast<int>(syscall(__NR_memfd_create, name, 0));
+  if (fd == -1) return std::nullopt;
+  if (ftruncate(fd, size) != 0) {
+    close(fd);
+    return std::nullopt;
+  }
+  return SharedMemoryHandle::FromPlatformHandle(fd);
+#else
+  return std::nullopt;
+#endif  // defined(__NR_memfd_create)
+}
+
+// static
+bool OS::WriteSharedMemory(SharedMemoryHandle handle, uint64_t offset,
+                           const void* data, size_t size) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  while (size > 0) {
+    ssize_t written = pwrite(handle.GetPlatformHandle(), bytes, size,
+                             static_cast<off_t>(offset));
+    if (written < 0 && errno == EINTR) continue;
+    if (written <= 0) return false;
+    bytes += written;
+    offset += written;
+    size -= written;
+  }
+  return true;
+}
+
+// static
+bool OS::ReadSharedMemory(SharedMemoryHandle handle, uint64_t offset,
+                          void* data, size_t size) {
+  uint8_t* bytes = static_cast<uint8_t*>(data);
+  while (size > 0) {
+    ssize_t bytes_read = pread(handle.GetPlatformHandle(), bytes, size,
+                               static_cast<off_t>(offset));
+    if (bytes_read < 0 && errno == EINTR) continue;
+    if (bytes_read <= 0) return false;
+    bytes += bytes_read;
+    offset += bytes_read;
+    size -= bytes_read;
+  }
+  return true;
+}
+
+// static
+bool OS::MapSharedMemoryPrivately(void* address, size_t size,
+                                  SharedMemoryHandle handle, uint64_t offset,
+                                  MemoryPermission access) {
+  DCHECK(IsAligned(reinterpret_cast<uintptr_t>(address), CommitPageSize()));
+  DCHECK(IsAligned(size, CommitPageSize()));
+  DCHECK(IsAligned(offset, CommitPageSize()));
+  void* result = mmap(address, size, GetProtectionFromMemoryPermission(access),
+                      MAP_FIXED | MAP_PRIVATE, handle.GetPlatformHandle(),
+                      static_cast<off_t>(offset));
+  if (result == MAP_FAILED) return false;
+  CHECK_EQ(result, address);
+  return true;
+}
+
 SignalSafeMapsParser::SignalSafeMapsParser(int fd, bool should_close_fd)
     : fd_(fd >= 0 ? fd : open("/proc/self/maps", O_RDONLY)),
       should_close_fd_(fd >= 0 ? should_close_fd : true),
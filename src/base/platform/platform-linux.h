@@ -58,6 +58,12 @@ class V8_BASE_EXPORT SignalSafeMapsParser {
   ssize_t buffer_end_;
 };
 
+// Reads cgroup v2 memory information. |cgroup_root| is the mount point of the
+// cgroup2 file system and |proc_root| the mount point of procfs. Both are
+// parameters for testing.
+V8_BASE_EXPORT OS::ContainerMemoryInfo ReadContainerMemoryInfo(
+    const std::string& cgroup_root, const std::string& proc_root);
+
 // The |fp| parameter is for testing, to pass a fake /proc/self/maps file.
 V8_BASE_EXPORT std::vector<OS::SharedLibraryAddress> GetSharedLibraryAddresses(
     FILE* fp);
@@ -19,6 +19,7 @@
 #include <sched.h>  // for sched_yield
 #include <signal.h>
 #include <stdio.h>
+#include <string.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/time.h>
@@ -782,6 +783,76 @@ bool OS::HasLazyCommits() {
 #endif  // !V8_OS_ZOS
 #endif  // !V8_OS_CYGWIN && !V8_OS_FUCHSIA
 
+#if V8_OS_LINUX && !V8_OS_ANDROID
+namespace {
+
+size_t ComputeHugePageSize() {
+  // Transparent huge pages may be compiled in but disabled at runtime.
+  FILE* enabled = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+  if (enabled == nullptr) return 0;
+  char mode[64] = {0};
+  const bool has_mode = fgets(mode, sizeof(mode), enabled) != nullptr;
+  fclose(enabled);
+  if (!has_mode || strstr(mode, "[never]") != nullptr) return 0;
+
+  FILE* size_file =
+      fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+  if (size_file == nullptr) return 0;
+  size_t size = 0;
+  if (fscanf(size_file, "%zu", &size) != 1) size = 0;
+  fclose(size_file);
+  const size_t page_size = static_cast<size_t>(getpagesize());
+  if (size <= page_size || (size & (size - 1)) != 0) return 0;
+  return size;
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX && !V8_OS_ANDROID
+
+// static
+size_t OS::HugePageSize() {
+#if V8_OS_LINUX && !V8_OS_ANDROID
+  static const size_t huge_page_size = ComputeHugePageSize();
+  return huge_page_size;
+#else
+  return 0;
+#endif
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size, bool enable) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && !V8_OS_ANDROID && defined(MADV_HUGEPAGE)
+  if (HugePageSize() == 0) return false;
+  return madvise(address, size, enable ? MADV_HUGEPAGE : MADV_NOHUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::CollapseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && !V8_OS_ANDROID
+  const size_t huge_page_size = HugePageSize();
+  if (huge_page_size == 0) return false;
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % huge_page_size);
+  DCHECK_EQ(0, size % huge_page_size);
+#ifndef MADV_COLLAPSE
+  // Available since Linux 6.1. Older kernels reject the advice with EINVAL.
+  static constexpr int MADV_COLLAPSE = 25;
+#endif
+  return madvise(address, size, MADV_COLLAPSE) == 0;
+#else
+  return false;
+#endif
+}
+
+#if !V8_OS_LINUX
+// static
+OS::ContainerMemoryInfo OS::GetContainerMemoryInfo() { return {}; }
+#endif  // !V8_OS_LINUX
+
 const char* OS::GetGCFakeMMapFile() {
   return g_gc_fake_mmap;
 }
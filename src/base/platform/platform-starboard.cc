@@ -225,6 +225,20 @@ bool OS::HasLazyCommits() {
   return false;
 }
 
+// static
+size_t OS::HugePageSize() { return 0; }
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size, bool enable) {
+  return false;
+}
+
+// static
+bool OS::CollapseHugePages(void* address, size_t size) { return false; }
+
+// static
+OS::ContainerMemoryInfo OS::GetContainerMemoryInfo() { return {}; }
+
 void OS::Sleep(TimeDelta interval) { SbThreadSleep(interval.InMicroseconds()); }
 
 void OS::Abort() { SbSystemBreakIntoDebugger(); }
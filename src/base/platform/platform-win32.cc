@@ -1140,6 +1140,20 @@ bool OS::DecommitPages(void* address, size_t size) {
 // static
 bool OS::SealPages(void* address, size_t size) { return false; }
 
+// static
+size_t OS::HugePageSize() { return 0; }
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size, bool enable) {
+  return false;
+}
+
+// static
+bool OS::CollapseHugePages(void* address, size_t size) { return false; }
+
+// static
+OS::ContainerMemoryInfo OS::GetContainerMemoryInfo() { return {}; }
+
 // static
 bool OS::CanReserveAddressSpace() {
   return VirtualAlloc2 != nullptr && MapViewOfFile3 != nullptr &&
@@ -237,6 +237,20 @@ class V8_BASE_EXPORT OS {
 
   static bool HasLazyCommits();
 
+  // Memory limit, usage and pressure of the cgroup v2 that the process belongs
+  // to. Fields are empty if the information is not available.
+  struct ContainerMemoryInfo {
+    // The smallest memory.max of the cgroup and its ancestors.
+    std::optional<uint64_t> limit;
+    // memory.current of the cgroup.
+    std::optional<uint64_t> usage;
+    // Share of wall time in percent in which some tasks stalled on memory over
+    // the last 10 seconds ("some avg10" of the pressure stall information).
+    std::optional<double> stall_percent;
+  };
+
+  static ContainerMemoryInfo GetContainerMemoryInfo();
+
   // Sleep for a specified time interval.
   static void Sleep(TimeDelta interval);
 
@@ -364,6 +378,44 @@ class V8_BASE_EXPORT OS {
   // Make part of the process's data memory read-only.
   static void SetDataReadOnly(void* address, size_t size);
 
+  // Returns the size of a transparent huge page, or 0 if the platform does not
+  // support transparent huge pages.
+  static size_t HugePageSize();
+
+  // Hints whether the pages in the given range should be backed by huge pages
+  // when they are committed. The range must be commit page aligned. Returns
+  // true if the hint was accepted.
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address, size_t size,
+                                                    bool enable);
+
+  // Synchronously backs the given range with huge pages where possible. The
+  // range must be huge page aligned. Returns true on success.
+  V8_WARN_UNUSED_RESULT static bool CollapseHugePages(void* address,
+                                                      size_t size);
+
+#if V8_OS_LINUX
+  // Helpers to back identical pages in different parts of the address space
+  // with the same physical memory. The shared memory object is created with
+  // |size| zero bytes. |name| only shows up in /proc/$pid/maps.
+  static std::optional<SharedMemoryHandle> CreateSharedMemoryHandle(
+      size_t size, const char* name);
+  V8_WARN_UNUSED_RESULT static bool WriteSharedMemory(SharedMemoryHandle handle,
+                                                      uint64_t offset,
+                                                      const void* data,
+                                                      size_t size);
+  V8_WARN_UNUSED_RESULT static bool ReadSharedMemory(SharedMemoryHandle handle,
+                                                     uint64_t offset,
+                                                     void* data, size_t size);
+
+  // Replaces the pages at |address| with a private mapping of |handle| at
+  // |offset|. The pages are shared with other mappings of |handle| until they
+  // are written to, which copies them. |address|, |size| and |offset| must be
+  // commit page aligned. If this fails the range may be left unmapped.
+  V8_WARN_UNUSED_RESULT static bool MapSharedMemoryPrivately(
+      void* address, size_t size, SharedMemoryHandle handle, uint64_t offset,
+      MemoryPermission access);
+#endif  // V8_OS_LINUX
+
  private:
   // Assign a name to a memory region.
   //
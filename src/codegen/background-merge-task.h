@@ -51,6 +51,15 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   Handle<SharedFunctionInfo> CompleteMergeInForeground(
       Isolate* isolate, DirectHandle<Script> new_script);
 
+  // Optional incremental step 3: on the main thread, merge at most `max_infos`
+  // of the script's infos, so that the main thread can do other work
+  // (including running JavaScript) in between. Returns true once all infos
+  // are merged. CompleteMergeInForeground must still be called afterwards, it
+  // then only merges what is left.
+  bool ContinueMergeInForeground(Isolate* isolate,
+                                 DirectHandle<Script> new_script,
+                                 uint32_t max_infos);
+
   bool HasPendingBackgroundWork() const {
     return state_ == kPendingBackgroundWork;
   }
@@ -61,6 +70,17 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   static void ForceGCDuringNextMergeForTesting();
 
  private:
+  // Forwards references from the new data to infos which the cached script
+  // gained since the background merge or the last foreground increment.
+  void ForwardToInfosAddedToCachedScript(Isolate* isolate,
+                                         DirectHandle<Script> old_script,
+                                         DirectHandle<Script> new_script);
+  // Merges the infos from merged_infos_count_ up to `end`, counted backwards
+  // from the last info.
+  void MergeInfosInForeground(Isolate* isolate,
+                              DirectHandle<Script> old_script,
+                              DirectHandle<Script> new_script, uint32_t end);
+
   std::unique_ptr<PersistentHandles> persistent_handles_;
 
   // Data from main thread:
@@ -93,6 +113,10 @@ class V8_EXPORT_PRIVATE BackgroundMergeTask {
   std::vector<NewCompiledDataForCachedSfi> new_compiled_data_for_cached_sfis_;
   std::unordered_set<int> sfis_without_scope_info_;
 
+  // Progress of the foreground merge.
+  uint32_t merged_infos_count_ = 0;
+  size_t merged_compiled_data_count_ = 0;
+
   enum State {
     kNotStarted,
     kPendingBackgroundWork,
@@ -29,6 +29,7 @@
 #include "src/compiler/turbofan.h"
 #include "src/debug/debug.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/execution/feedback-profile.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/local-isolate.h"
@@ -1452,6 +1453,9 @@ void FinalizeUnoptimizedCompilation(
     if (need_source_positions) {
       SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate, shared_info);
     }
+    if (V8_UNLIKELY(isolate->feedback_profile())) {
+      isolate->feedback_profile()->ApplyTieringDecision(isolate, *shared_info);
+    }
     LogEventListener::CodeTag log_tag;
     if (shared_info->is_toplevel()) {
       log_tag = flags.is_eval() ? LogEventListener::CodeTag::kEval
@@ -2565,12 +2569,9 @@ void BackgroundMergeTask::BeginMergeInBackground(
   state_ = kPendingForegroundWork;
 }
 
-Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
-    Isolate* isolate, DirectHandle<Script> new_script) {
-  DCHECK_EQ(state_, kPendingForegroundWork);
-
-  HandleScope handle_scope(isolate);
-  DirectHandle<Script> old_script = cached_script_.ToHandleChecked();
+void BackgroundMergeTask::ForwardToInfosAddedToCachedScript(
+    Isolate* isolate, DirectHandle<Script> old_script,
+    DirectHandle<Script> new_script) {
   ConstantPoolPointerForwarder forwarder(isolate->main_thread_local_heap(),
                                          old_script);
 
@@ -2588,6 +2589,9 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
       if (maybe_new_info != maybe_old_info &&
           Is<SharedFunctionInfo>(maybe_old_info.GetHeapObjectAssumeWeak())) {
         forwarder.set_has_shared_function_info_to_forward();
+        // Like in the background, point to the cached script's info from the
+        // new script, so that later increments don't forward it again.
+        new_script->infos()->set(i, maybe_old_info);
       }
       forwarder.RecordScopeInfos(maybe_old_info);
     }
@@ -2619,8 +2623,15 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
     }
     forwarder.IterateAndForwardPointers();
   }
+}
 
-  auto compiled_data_it = new_compiled_data_for_cached_sfis_.rbegin();
+void BackgroundMergeTask::MergeInfosInForeground(
+    Isolate* isolate, DirectHandle<Script> old_script,
+    DirectHandle<Script> new_script, uint32_t end) {
+  uint32_t old_script_infos_len = old_script->infos()->ulength().value();
+  DCHECK_LE(end, old_script_infos_len);
+  auto compiled_data_it =
+      new_compiled_data_for_cached_sfis_.rbegin() + merged_compiled_data_count_;
 
   // Release the compiled data backwards to make sure that subtrees are always
   // consistent. Infos in the table are ordered by nesting, so this ensures that
@@ -2628,8 +2639,9 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
   // in the table as well.
   // This is important because other background merge tasks as well as
   // concurrently running optimizing compile jobs might be looking at what we
-  // release here.
-  for (uint32_t index = 0; index < old_script_infos_len; ++index) {
+  // release here. For the same reason, JavaScript running between increments
+  // of the merge only ever sees complete subtrees.
+  for (uint32_t index = merged_infos_count_; index < end; ++index) {
     uint32_t i = old_script_infos_len - 1 - index;
     Tagged<MaybeObject> maybe_old_info = old_script->infos()->get(i);
     Tagged<MaybeObject> maybe_new_info = new_script->infos()->get(i);
@@ -2654,11 +2666,42 @@ Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
           sfi->CopyFrom(*compiled_data_it->new_sfi, isolate);
         }
         compiled_data_it++;
+        merged_compiled_data_count_++;
       }
     } else if (!maybe_old_info.IsWeak()) {
       old_script->infos()->set(i, maybe_new_info, kReleaseStore);
     }
   }
+  merged_infos_count_ = end;
+}
+
+bool BackgroundMergeTask::ContinueMergeInForeground(
+    Isolate* isolate, DirectHandle<Script> new_script, uint32_t max_infos) {
+  DCHECK_EQ(state_, kPendingForegroundWork);
+  DCHECK_GT(max_infos, 0u);
+
+  HandleScope handle_scope(isolate);
+  DirectHandle<Script> old_script = cached_script_.ToHandleChecked();
+  // JavaScript may have run since the last increment and added infos to the
+  // cached script.
+  ForwardToInfosAddedToCachedScript(isolate, old_script, new_script);
+
+  uint32_t old_script_infos_len = old_script->infos()->ulength().value();
+  uint32_t remaining = old_script_infos_len - merged_infos_count_;
+  MergeInfosInForeground(isolate, old_script, new_script,
+                         merged_infos_count_ + std::min(max_infos, remaining));
+  return merged_infos_count_ == old_script_infos_len;
+}
+
+Handle<SharedFunctionInfo> BackgroundMergeTask::CompleteMergeInForeground(
+    Isolate* isolate, DirectHandle<Script> new_script) {
+  DCHECK_EQ(state_, kPendingForegroundWork);
+
+  HandleScope handle_scope(isolate);
+  DirectHandle<Script> old_script = cached_script_.ToHandleChecked();
+  ForwardToInfosAddedToCachedScript(isolate, old_script, new_script);
+  MergeInfosInForeground(isolate, old_script, new_script,
+                         old_script->infos()->ulength().value());
 
   Tagged<MaybeObject> maybe_toplevel_sfi =
       old_script->infos()->get(kFunctionLiteralIdTopLevel);
@@ -2857,6 +2900,12 @@ void BackgroundDeserializeTask::SourceTextAvailable(
   LanguageMode language_mode = construct_language_mode(v8_flags.use_strict);
   background_merge_task_.SetUpOnMainThread(isolate, source_text, script_details,
                                            language_mode);
+  DirectHandle<FixedArray> wrapped_arguments;
+  if (!script_details.wrapped_arguments.is_null()) {
+    wrapped_arguments = script_details.wrapped_arguments.ToHandleChecked();
+  }
+  expected_source_hash_ = SerializedCodeData::SourceHash(
+      source_text, wrapped_arguments, script_details.origin_options);
 }
 
 bool BackgroundDeserializeTask::ShouldMergeWithExistingScript() const {
@@ -2879,6 +2928,28 @@ void BackgroundDeserializeTask::MergeWithExistingScript() {
       &isolate, off_thread_data_.GetOnlyScript(isolate.heap()));
 }
 
+bool BackgroundDeserializeTask::ContinueMergeInForeground(Isolate* isolate,
+                                                          uint32_t max_infos) {
+  DCHECK_EQ(isolate, isolate_for_local_isolate_);
+  if (!background_merge_task_.HasPendingForegroundWork()) return true;
+
+  // The source was only checked against the cached data when finishing so
+  // far. Don't merge anything into the cached script before that check passed.
+  SerializedCodeSanityCheckResult sanity_check_result =
+      SerializedCodeSanityCheckResult::kSuccess;
+  SerializedCodeData::FromPartiallySanityCheckedCachedData(
+      &cached_data_, expected_source_hash_, &sanity_check_result);
+  if (sanity_check_result != SerializedCodeSanityCheckResult::kSuccess) {
+    return true;
+  }
+
+  HandleScope handle_scope(isolate);
+  DirectHandle<Script> new_script =
+      off_thread_data_.GetOnlyScript(isolate->main_thread_local_heap());
+  return background_merge_task_.ContinueMergeInForeground(isolate, new_script,
+                                                          max_infos);
+}
+
 MaybeDirectHandle<SharedFunctionInfo> BackgroundDeserializeTask::Finish(
     Isolate* isolate, DirectHandle<String> source,
     const ScriptDetails& script_details) {
@@ -3955,6 +4026,15 @@ MaybeDirectHandle<SharedFunctionInfo> GetSharedFunctionInfoForScriptImpl(
     ScriptCompiler::CompilationDetails* compilation_details) {
   ScriptCompileTimerScope compile_timer(isolate, no_cache_reason,
                                         compilation_details);
+  // Only the first non-native script compiled in the isolate is considered
+  // part of its startup.
+  std::optional<StartupTimeline::Scope> timeline_scope;
+  if (natives == NOT_NATIVES_CODE &&
+      !isolate->startup_timeline()->Contains(
+          StartupTimeline::Phase::kFirstScriptCompile)) {
+    timeline_scope.emplace(isolate,
+                           StartupTimeline::Phase::kFirstScriptCompile);
+  }
 
   if (compile_options & ScriptCompiler::kConsumeCodeCache) {
     // Have to have exactly one of cached_data or deserialize_task.
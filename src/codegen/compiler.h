@@ -706,6 +706,13 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   // once.
   void MergeWithExistingScript();
 
+  // Performs part of the main-thread work of the merge started by
+  // MergeWithExistingScript, see
+  // BackgroundMergeTask::ContinueMergeInForeground. Returns true once Finish
+  // has no merge work left. May only be called on a
+  // thread where the Isolate is currently entered.
+  bool ContinueMergeInForeground(Isolate* isolate, uint32_t max_infos);
+
   MaybeDirectHandle<SharedFunctionInfo> Finish(
       Isolate* isolate, DirectHandle<String> source,
       const ScriptDetails& script_details);
@@ -721,6 +728,8 @@ class V8_EXPORT_PRIVATE BackgroundDeserializeTask {
   AlignedCachedData cached_data_;
   CodeSerializer::OffThreadDeserializeData off_thread_data_;
   BackgroundMergeTask background_merge_task_;
+  // Set by SourceTextAvailable.
+  uint32_t expected_source_hash_ = 0;
   TimedHistogram* timer_;
   int64_t background_time_in_microseconds_ = 0;
 };
@@ -0,0 +1,606 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/turboshaft/loop-vectorization-reducer.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#ifdef DEBUG
+#define TRACE(x)                                                               \
+  do {                                                                         \
+    if (v8_flags.turboshaft_trace_vectorization)                               \
+      StdoutStream() << x << std::endl;                                        \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+using OpKind = LoopVectorizationAnalyzer::OpKind;
+using LaneKind = LoopVectorizationAnalyzer::LaneKind;
+using OpInfo = LoopVectorizationAnalyzer::OpInfo;
+
+namespace {
+
+LaneKind LaneKindForMemoryRepresentation(MemoryRepresentation rep) {
+  if (rep == MemoryRepresentation::Int32() ||
+      rep == MemoryRepresentation::Uint32()) {
+    return LaneKind::kI32x4;
+  }
+  if (rep == MemoryRepresentation::Float32()) return LaneKind::kF32x4;
+  if (rep == MemoryRepresentation::Float64()) return LaneKind::kF64x2;
+  return LaneKind::kNone;
+}
+
+LaneKind LaneKindForFloatRepresentation(FloatRepresentation rep) {
+  return rep == FloatRepresentation::Float64() ? LaneKind::kF64x2
+                                               : LaneKind::kF32x4;
+}
+
+bool IsLaneWiseWordBinop(WordBinopOp::Kind kind) {
+  switch (kind) {
+    case WordBinopOp::Kind::kAdd:
+    case WordBinopOp::Kind::kSub:
+    case WordBinopOp::Kind::kMul:
+    case WordBinopOp::Kind::kBitwiseAnd:
+    case WordBinopOp::Kind::kBitwiseOr:
+    case WordBinopOp::Kind::kBitwiseXor:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsLaneWiseFloatBinop(FloatBinopOp::Kind kind) {
+  switch (kind) {
+    case FloatBinopOp::Kind::kAdd:
+    case FloatBinopOp::Kind::kSub:
+    case FloatBinopOp::Kind::kMul:
+    case FloatBinopOp::Kind::kDiv:
+    case FloatBinopOp::Kind::kMin:
+    case FloatBinopOp::Kind::kMax:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsLaneWiseFloatUnary(FloatUnaryOp::Kind kind) {
+  switch (kind) {
+    case FloatUnaryOp::Kind::kAbs:
+    case FloatUnaryOp::Kind::kNegate:
+    case FloatUnaryOp::Kind::kSqrt:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool IsLaneWiseShift(ShiftOp::Kind kind) {
+  switch (kind) {
+    case ShiftOp::Kind::kShiftLeft:
+    case ShiftOp::Kind::kShiftRightArithmetic:
+    case ShiftOp::Kind::kShiftRightArithmeticShiftOutZeros:
+    case ShiftOp::Kind::kShiftRightLogical:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Conversions that are monotonic over [0, kMaxInt], and that thus preserve
+// the order of the lanes.
+bool IsMonotonicChange(ChangeOp::Kind kind) {
+  switch (kind) {
+    case ChangeOp::Kind::kSignExtend:
+    case ChangeOp::Kind::kZeroExtend:
+    case ChangeOp::Kind::kSignedToFloat:
+    case ChangeOp::Kind::kUnsignedToFloat:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+void LoopVectorizationAnalyzer::DetectVectorizableLoops() {
+  for (const auto& [header, info] : loop_finder_.LoopHeaders()) {
+    if (info.has_inner_loops || info.has_any_call) continue;
+    if (info.op_count > kMaxLoopSize || info.block_count > kMaxLoopBlocks) {
+      continue;
+    }
+
+    TRACE("LoopVectorization: considering loop at " << header->index().id());
+    VectorLoop loop(phase_zone_);
+    if (TryVectorizeLoop(header, info, &loop)) {
+      TRACE("> Vectorizable with " << loop.lane_count() << " lanes");
+      vector_loops_.emplace(header, std::move(loop));
+    } else {
+      ResetLoop(loop);
+    }
+  }
+}
+
+bool LoopVectorizationAnalyzer::TryVectorizeLoop(
+    const Block* header, const LoopFinder::LoopInfo& info, VectorLoop* loop) {
+  if (!CollectBlocks(header, info, loop)) {
+    TRACE("> Not a straight chain of blocks");
+    return false;
+  }
+  if (!ClassifyPhis(loop)) {
+    TRACE("> Unsupported loop phis");
+    return false;
+  }
+
+  for (const Block* block : loop->blocks) {
+    for (OpIndex idx : input_graph_->OperationIndices(*block)) {
+      const Operation& op = input_graph_->Get(idx);
+      if (op.Is<PhiOp>()) {
+        // Phis were classified by ClassifyPhis.
+        if (block != header) return false;
+        continue;
+      }
+      OpInfo op_info = ClassifyOp(loop, idx, op);
+      if (op_info.kind == OpKind::kNone) {
+        TRACE("> Cannot vectorize #" << idx.id() << ": " << op);
+        return false;
+      }
+      op_info_[idx] = op_info;
+    }
+  }
+
+  return FinalizeLoop(loop);
+}
+
+bool LoopVectorizationAnalyzer::CollectBlocks(const Block* header,
+                                              const LoopFinder::LoopInfo& info,
+                                              VectorLoop* loop) {
+  // The header should be the only block that can exit the loop, and the body
+  // should be a straight chain of blocks ending with the backedge.
+  const BranchOp* branch =
+      header->LastOperation(*input_graph_).TryCast<BranchOp>();
+  if (!branch) return false;
+  bool true_in_loop = loop_finder_.GetLoopHeader(branch->if_true) == header;
+  bool false_in_loop = loop_finder_.GetLoopHeader(branch->if_false) == header;
+  if (true_in_loop == false_in_loop) return false;
+  loop->continue_if_true = true_in_loop;
+
+  loop->blocks.push_back(header);
+  const Block* block = true_in_loop ? branch->if_true : branch->if_false;
+  while (loop->blocks.size() < info.block_count) {
+    if (block == header || block->PredecessorCount() != 1) return false;
+    loop->blocks.push_back(block);
+    const GotoOp* gto = block->LastOperation(*input_graph_).TryCast<GotoOp>();
+    if (!gto) return false;
+    if (gto->destination == header) {
+      return gto->is_backedge && loop->blocks.size() == info.block_count;
+    }
+    block = gto->destination;
+  }
+  return false;
+}
+
+bool LoopVectorizationAnalyzer::ClassifyPhis(VectorLoop* loop) {
+  const Block* header = loop->header();
+  for (OpIndex idx : input_graph_->OperationIndices(*header)) {
+    const PhiOp* phi = input_graph_->Get(idx).TryCast<PhiOp>();
+    if (!phi) continue;
+    if (!loop->induction_phi.valid() &&
+        IsInductionUpdate(idx, phi->back_edge(), loop)) {
+      loop->induction_phi = idx;
+      op_info_[idx] = {OpKind::kLinear, LaneKind::kNone};
+    } else if (!loop->reduction_phi.valid() &&
+               IsReductionUpdate(*phi, idx, phi->back_edge())) {
+      loop->reduction_phi = idx;
+      loop->reduction_update = phi->back_edge();
+      op_info_[idx] = {OpKind::kReductionPhi, LaneKind::kNone};
+    } else {
+      return false;
+    }
+  }
+  return loop->induction_phi.valid();
+}
+
+bool LoopVectorizationAnalyzer::IsInductionUpdate(OpIndex phi, OpIndex update,
+                                                  VectorLoop* loop) const {
+  if (input_graph_->Get(phi).Cast<PhiOp>().rep !=
+      RegisterRepresentation::Word32()) {
+    return false;
+  }
+  auto is_increment = [&](OpIndex left, OpIndex right) {
+    int32_t cst;
+    return (left == phi && matcher_.MatchIntegralWord32Constant(right, &cst) &&
+            cst == 1) ||
+           (right == phi && matcher_.MatchIntegralWord32Constant(left, &cst) &&
+            cst == 1);
+  };
+
+  const Operation& op = input_graph_->Get(update);
+  if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+    if (binop->kind != WordBinopOp::Kind::kAdd ||
+        binop->rep != WordRepresentation::Word32() ||
+        !is_increment(binop->left(), binop->right())) {
+      return false;
+    }
+    loop->induction_update = update;
+    return true;
+  }
+  if (const ProjectionOp* projection = op.TryCast<ProjectionOp>()) {
+    if (projection->index != OverflowCheckedBinopOp::kValueIndex) return false;
+    const OverflowCheckedBinopOp* binop =
+        input_graph_->Get(projection->input())
+            .TryCast<OverflowCheckedBinopOp>();
+    if (!binop || binop->kind != OverflowCheckedBinopOp::Kind::kSignedAdd ||
+        binop->rep != WordRepresentation::Word32() ||
+        !is_increment(binop->left(), binop->right())) {
+      return false;
+    }
+    loop->induction_update = update;
+    loop->induction_overflow_check = projection->input();
+    return true;
+  }
+  return false;
+}
+
+bool LoopVectorizationAnalyzer::IsReductionUpdate(const PhiOp& phi,
+                                                  OpIndex phi_index,
+                                                  OpIndex update) const {
+  const Operation& op = input_graph_->Get(update);
+  if (op.input_count != 2) return false;
+  if ((op.input(0) == phi_index) == (op.input(1) == phi_index)) return false;
+
+  if (const WordBinopOp* binop = op.TryCast<WordBinopOp>()) {
+    if (binop->rep != WordRepresentation::Word32()) return false;
+    switch (binop->kind) {
+      case WordBinopOp::Kind::kAdd:
+      case WordBinopOp::Kind::kMul:
+      case WordBinopOp::Kind::kBitwiseAnd:
+      case WordBinopOp::Kind::kBitwiseOr:
+      case WordBinopOp::Kind::kBitwiseXor:
+        return true;
+      default:
+        return false;
+    }
+  }
+  if (const FloatBinopOp* binop = op.TryCast<FloatBinopOp>()) {
+    // Floating-point additions and multiplications are not associative, so
+    // only min and max can be computed out of order.
+    return binop->kind == FloatBinopOp::Kind::kMin ||
+           binop->kind == FloatBinopOp::Kind::kMax;
+  }
+  return false;
+}
+
+OpInfo LoopVectorizationAnalyzer::ClassifyOp(VectorLoop* loop, OpIndex idx,
+                                             const Operation& op) {
+  constexpr OpInfo kUniform{OpKind::kUniform, LaneKind::kNone};
+  constexpr OpInfo kNone{OpKind::kNone, LaneKind::kNone};
+  auto all_uniform = [&]() {
+    for (OpIndex input : op.inputs()) {
+      if (InputKind(*loop, input) != OpKind::kUniform) return false;
+    }
+    return true;
+  };
+
+  if (idx == loop->induction_update ||
+      idx == loop->induction_overflow_check) {
+    return {OpKind::kInduction, LaneKind::kNone};
+  }
+
+  switch (op.opcode) {
+    case Opcode::kConstant:
+      return kUniform;
+
+    case Opcode::kTaggedBitcast:
+      return all_uniform() ? kUniform : kNone;
+
+    case Opcode::kWordBinop: {
+      if (all_uniform()) return kUniform;
+      const WordBinopOp& binop = op.Cast<WordBinopOp>();
+      if (binop.rep != WordRepresentation::Word32() ||
+          !IsLaneWiseWordBinop(binop.kind)) {
+        return kNone;
+      }
+      if (idx == loop->reduction_update) {
+        OpIndex value = binop.left() == loop->reduction_phi ? binop.right()
+                                                            : binop.left();
+        OpInfo info = ClassifyVectorOp(*loop, LaneKind::kI32x4,
+                                       base::VectorOf(&value, 1));
+        if (info.kind == OpKind::kNone) return kNone;
+        return {OpKind::kReduction, LaneKind::kI32x4};
+      }
+      return ClassifyVectorOp(*loop, LaneKind::kI32x4, op.inputs());
+    }
+
+    case Opcode::kShift: {
+      if (all_uniform()) return kUniform;
+      const ShiftOp& shift = op.Cast<ShiftOp>();
+      if (shift.rep != WordRepresentation::Word32() ||
+          !IsLaneWiseShift(shift.kind) ||
+          InputKind(*loop, shift.right()) != OpKind::kUniform) {
+        return kNone;
+      }
+      OpIndex left = shift.left();
+      return ClassifyVectorOp(*loop, LaneKind::kI32x4,
+                              base::VectorOf(&left, 1));
+    }
+
+    case Opcode::kFloatBinop: {
+      if (all_uniform()) return kUniform;
+      const FloatBinopOp& binop = op.Cast<FloatBinopOp>();
+      if (!IsLaneWiseFloatBinop(binop.kind)) return kNone;
+      LaneKind lanes = LaneKindForFloatRepresentation(binop.rep);
+      if (idx == loop->reduction_update) {
+        OpIndex value = binop.left() == loop->reduction_phi ? binop.right()
+                                                            : binop.left();
+        OpInfo info =
+            ClassifyVectorOp(*loop, lanes, base::VectorOf(&value, 1));
+        if (info.kind == OpKind::kNone) return kNone;
+        return {OpKind::kReduction, lanes};
+      }
+      return ClassifyVectorOp(*loop, lanes, op.inputs());
+    }
+
+    case Opcode::kFloatUnary: {
+      if (all_uniform()) return kUniform;
+      const FloatUnaryOp& unary = op.Cast<FloatUnaryOp>();
+      if (!IsLaneWiseFloatUnary(unary.kind)) return kNone;
+      return ClassifyVectorOp(*loop, LaneKindForFloatRepresentation(unary.rep),
+                              op.inputs());
+    }
+
+    case Opcode::kChange: {
+      if (all_uniform()) return kUniform;
+      const ChangeOp& change = op.Cast<ChangeOp>();
+      if (InputKind(*loop, change.input()) == OpKind::kLinear &&
+          IsMonotonicChange(change.kind)) {
+        return {OpKind::kLinear, LaneKind::kNone};
+      }
+      return kNone;
+    }
+
+    case Opcode::kComparison: {
+      if (all_uniform()) return kUniform;
+      const ComparisonOp& cmp = op.Cast<ComparisonOp>();
+      // Equality isn't monotonic over the lanes.
+      if (cmp.kind == ComparisonOp::Kind::kEqual) return kNone;
+      OpKind left = InputKind(*loop, cmp.left());
+      OpKind right = InputKind(*loop, cmp.right());
+      if ((left == OpKind::kLinear && right == OpKind::kUniform) ||
+          (left == OpKind::kUniform && right == OpKind::kLinear)) {
+        return {OpKind::kLaneCondition, LaneKind::kNone};
+      }
+      return kNone;
+    }
+
+    case Opcode::kLoad: {
+      const LoadOp& load = op.Cast<LoadOp>();
+      if (load.kind.is_atomic) return kNone;
+      if (all_uniform()) {
+        // Uniform loads are hoisted above the vector stores of their
+        // iteration, which is only correct if they don't read typed arrays.
+        if (!load.kind.tagged_base && !load.kind.load_eliminable) {
+          loop->has_raw_uniform_loads = true;
+        }
+        return kUniform;
+      }
+      if (load.kind.tagged_base || load.kind.load_eliminable ||
+          load.result_rep !=
+              load.loaded_rep.ToRegisterRepresentation()) {
+        return kNone;
+      }
+      return ClassifyMemoryAccess(loop, idx, load.base(), load.index(),
+                                  load.loaded_rep, load.element_size_log2);
+    }
+
+    case Opcode::kStore: {
+      const StoreOp& store = op.Cast<StoreOp>();
+      if (store.kind.tagged_base || store.kind.load_eliminable ||
+          store.kind.is_atomic ||
+          store.write_barrier != WriteBarrierKind::kNoWriteBarrier ||
+          store.maybe_initializing_or_transitioning) {
+        return kNone;
+      }
+      OpInfo info =
+          ClassifyMemoryAccess(loop, idx, store.base(), store.index(),
+                               store.stored_rep, store.element_size_log2);
+      if (info.kind == OpKind::kNone) return kNone;
+      OpIndex value = store.value();
+      if (ClassifyVectorOp(*loop, info.lanes, base::VectorOf(&value, 1))
+              .kind == OpKind::kNone &&
+          InputKind(*loop, value) != OpKind::kUniform) {
+        return kNone;
+      }
+      loop->has_stores = true;
+      return info;
+    }
+
+    case Opcode::kRetain:
+      return all_uniform() ? OpInfo{OpKind::kRetain, LaneKind::kNone} : kNone;
+
+    case Opcode::kProjection: {
+      const ProjectionOp& projection = op.Cast<ProjectionOp>();
+      if (projection.input() == loop->induction_overflow_check) {
+        return {OpKind::kInduction, LaneKind::kNone};
+      }
+      return kNone;
+    }
+
+    case Opcode::kDeoptimizeIf: {
+      const DeoptimizeIfOp& deopt = op.Cast<DeoptimizeIfOp>();
+      switch (InputKind(*loop, deopt.condition())) {
+        case OpKind::kInduction:
+          // The overflow check of the induction variable: the vector loop
+          // exits before the induction variable could overflow.
+          return {OpKind::kInduction, LaneKind::kNone};
+        case OpKind::kUniform:
+        case OpKind::kLaneCondition:
+          return {OpKind::kWindowCheck, LaneKind::kNone};
+        default:
+          return kNone;
+      }
+    }
+
+    case Opcode::kFrameState:
+      return {OpKind::kFrameState, LaneKind::kNone};
+
+    case Opcode::kJSStackCheck: {
+      const JSStackCheckOp& check = op.Cast<JSStackCheckOp>();
+      if (check.kind != JSStackCheckOp::Kind::kLoop ||
+          loop->stack_check.valid() || !check.frame_state().has_value() ||
+          IsInLoop(*loop, check.native_context()) ||
+          !IsValidStackCheckFrameState(*loop, check.frame_state().value())) {
+        return kNone;
+      }
+      loop->stack_check = idx;
+      return {OpKind::kStackCheck, LaneKind::kNone};
+    }
+
+    case Opcode::kBranch: {
+      const BranchOp& branch = op.Cast<BranchOp>();
+      if (!loop->header()->Contains(idx) ||
+          InputKind(*loop, branch.condition()) != OpKind::kLaneCondition) {
+        return kNone;
+      }
+      return {OpKind::kControl, LaneKind::kNone};
+    }
+
+    case Opcode::kGoto:
+      return {OpKind::kControl, LaneKind::kNone};
+
+    default:
+      return kNone;
+  }
+}
+
+OpInfo LoopVectorizationAnalyzer::ClassifyVectorOp(
+    const VectorLoop& loop, LaneKind lanes,
+    base::Vector<const OpIndex> inputs) const {
+  // Lane-wise operations take vectors of the same lane kind, or uniform
+  // values that are splatted. At least one input has to be a vector.
+  bool has_vector_input = false;
+  for (OpIndex input : inputs) {
+    if (!IsInLoop(loop, input)) continue;
+    OpInfo info = op_info_[input];
+    if (info.kind == OpKind::kUniform) continue;
+    if (info.kind != OpKind::kVector || info.lanes != lanes) return {};
+    has_vector_input = true;
+  }
+  if (!has_vector_input) return {};
+  return {OpKind::kVector, lanes};
+}
+
+OpInfo LoopVectorizationAnalyzer::ClassifyMemoryAccess(
+    VectorLoop* loop, OpIndex idx, OpIndex base, OptionalOpIndex index,
+    MemoryRepresentation rep, uint8_t element_size_log2) {
+  LaneKind lanes = LaneKindForMemoryRepresentation(rep);
+  // The index has to be the induction variable (possibly extended to a
+  // pointer-sized value), for the lanes to be consecutive elements.
+  if (lanes == LaneKind::kNone ||
+      element_size_log2 != rep.SizeInBytesLog2() ||
+      InputKind(*loop, base) != OpKind::kUniform || !index.has_value() ||
+      InputKind(*loop, index.value()) != OpKind::kLinear ||
+      input_graph_->Get(index.value()).outputs_rep()[0] !=
+          RegisterRepresentation::WordPtr()) {
+    return {};
+  }
+  loop->memory_accesses.push_back(idx);
+  return {OpKind::kVector, lanes};
+}
+
+bool LoopVectorizationAnalyzer::IsValidStackCheckFrameState(
+    const VectorLoop& loop, OpIndex frame_state) const {
+  if (!IsInLoop(loop, frame_state)) return true;
+  const FrameStateOp* op =
+      input_graph_->Get(frame_state).TryCast<FrameStateOp>();
+  if (!op) return false;
+  bool uses_induction_phi = false, uses_induction_update = false;
+  bool uses_reduction_phi = false, uses_reduction_update = false;
+  for (OpIndex input : op->inputs()) {
+    if (input == loop.induction_phi) {
+      uses_induction_phi = true;
+    } else if (input == loop.induction_update) {
+      uses_induction_update = true;
+    } else if (input.valid() && input == loop.reduction_phi) {
+      uses_reduction_phi = true;
+    } else if (input.valid() && input == loop.reduction_update) {
+      uses_reduction_update = true;
+    } else if (!IsValidStackCheckFrameState(loop, input)) {
+      return false;
+    }
+  }
+  // The vector loop only knows the state between two iterations.
+  return !(uses_induction_phi && uses_induction_update) &&
+         !(uses_reduction_phi && uses_reduction_update);
+}
+
+bool LoopVectorizationAnalyzer::FinalizeLoop(VectorLoop* loop) {
+  if (loop->memory_accesses.empty()) {
+    TRACE("> No typed array accesses");
+    return false;
+  }
+  if (loop->has_stores && loop->has_raw_uniform_loads) {
+    TRACE("> Uniform typed array loads could alias stores");
+    return false;
+  }
+
+  // All of the vector operations should have the same number of lanes.
+  for (const Block* block : loop->blocks) {
+    for (OpIndex idx : input_graph_->OperationIndices(*block)) {
+      OpInfo info = op_info_[idx];
+      if (info.kind != OpKind::kVector && info.kind != OpKind::kReduction) {
+        continue;
+      }
+      if (loop->lanes == LaneKind::kNone) {
+        loop->lanes = info.lanes;
+      } else if (LaneCount(loop->lanes) != LaneCount(info.lanes)) {
+        TRACE("> Mixed lane counts");
+        return false;
+      }
+    }
+  }
+  if (loop->reduction_phi.valid()) {
+    loop->lanes = op_info_[loop->reduction_update].lanes;
+  }
+
+  // Accesses with different bases could partially overlap if they are views
+  // on the same buffer.
+  for (OpIndex store_idx : loop->memory_accesses) {
+    const StoreOp* store = input_graph_->Get(store_idx).TryCast<StoreOp>();
+    if (!store) continue;
+    for (OpIndex other_idx : loop->memory_accesses) {
+      if (other_idx == store_idx) continue;
+      const Operation& other = input_graph_->Get(other_idx);
+      OpIndex other_base;
+      int32_t other_offset;
+      if (const LoadOp* load = other.TryCast<LoadOp>()) {
+        other_base = load->base();
+        other_offset = load->offset;
+      } else {
+        // Only check each pair of stores once.
+        if (other_idx < store_idx) continue;
+        const StoreOp& other_store = other.Cast<StoreOp>();
+        other_base = other_store.base();
+        other_offset = other_store.offset;
+      }
+      if (other_base == store->base() && other_offset == store->offset) {
+        continue;
+      }
+      loop->alias_checks.push_back({store_idx, other_idx});
+    }
+  }
+  return true;
+}
+
+void LoopVectorizationAnalyzer::ResetLoop(const VectorLoop& loop) {
+  for (const Block* block : loop.blocks) {
+    for (OpIndex idx : input_graph_->OperationIndices(*block)) {
+      op_info_[idx] = OpInfo{};
+    }
+  }
+}
+
+#undef TRACE
+
+}  // namespace v8::internal::compiler::turboshaft
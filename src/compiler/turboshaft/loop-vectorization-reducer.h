@@ -0,0 +1,824 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
+#define V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
+
+#include <cstring>
+#include <limits>
+#include <utility>
+
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+#include "src/base/small-vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/copying-phase.h"
+#include "src/compiler/turboshaft/index.h"
+#include "src/compiler/turboshaft/loop-finder.h"
+#include "src/compiler/turboshaft/operation-matcher.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/phase.h"
+#include "src/compiler/turboshaft/sidetable.h"
+#include "src/zone/zone-containers.h"
+
+#if !V8_ENABLE_SIMD128
+#error This header should only be included if SIMD128 is enabled.
+#endif  // !V8_ENABLE_SIMD128
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+// OVERVIEW:
+//
+// LoopVectorizationReducer vectorizes simple counted loops over typed arrays,
+// such as
+//
+//    for (let i = 0; i < a.length; i++) b[i] = a[i] * k;
+//    for (let i = 0; i < a.length; i++) s = (s + a[i]) | 0;
+//
+// using 128-bit SIMD operations. A vectorizable loop is an innermost loop
+// without calls made of a header that branches out of the loop and a straight
+// chain of body blocks. It has a Word32 induction variable `i` incremented by
+// 1, and at most one other loop phi, which has to be a reduction with an
+// associative and commutative operation. Its memory accesses are typed array
+// accesses indexed by `i`, which all have the same number of lanes (2 for
+// Float64Array, 4 for (U)Int32Array and Float32Array).
+//
+// Vectorizable loops are emitted as a vector loop followed by the original
+// scalar loop. Each iteration of the vector loop first evaluates the loop
+// condition and all of the deopt conditions of the original loop for the lanes
+// it is about to process. If any of these lanes would leave the loop or deopt,
+// or if some of its memory accesses partially overlap, the vector loop exits
+// and the scalar loop takes over from the current iteration. The scalar loop
+// thus serves both as the epilogue of the vector loop and as its deopt path
+// (for instance for detached or resized buffers): deopts always happen in
+// the scalar loop, with a precise frame state.
+//
+// Floating-point additions are not treated as reductions, since reordering
+// them would change the result.
+
+#ifdef DEBUG
+#define TRACE(x)                                                               \
+  do {                                                                         \
+    if (v8_flags.turboshaft_trace_vectorization)                               \
+      StdoutStream() << x << std::endl;                                        \
+  } while (false)
+#else
+#define TRACE(x)
+#endif
+
+class V8_EXPORT_PRIVATE LoopVectorizationAnalyzer {
+ public:
+  // Describes how an operation of a vectorizable loop is emitted in the vector
+  // loop.
+  enum class OpKind : uint8_t {
+    // Not part of a vectorizable loop.
+    kNone,
+    // Has the same value for all lanes; computed once per vector iteration.
+    kUniform,
+    // The induction variable or a conversion of it; emitted on demand for a
+    // given lane.
+    kLinear,
+    // A comparison between a kLinear and a kUniform value.
+    kLaneCondition,
+    // A lane-wise value or typed array access.
+    kVector,
+    // The reduction phi, and the operation computing its next value.
+    kReductionPhi,
+    kReduction,
+    // The increment of the induction variable and its overflow check, which
+    // the vector loop replaces by its own increment.
+    kInduction,
+    // A DeoptimizeIf, which the vector loop turns into an exit to the scalar
+    // loop.
+    kWindowCheck,
+    kStackCheck,
+    // Frame states are only emitted for the stack check.
+    kFrameState,
+    kRetain,
+    kControl,
+  };
+  enum class LaneKind : uint8_t { kNone, kI32x4, kF32x4, kF64x2 };
+
+  struct OpInfo {
+    OpKind kind = OpKind::kNone;
+    LaneKind lanes = LaneKind::kNone;
+  };
+
+  struct VectorLoop {
+    explicit VectorLoop(Zone* zone)
+        : blocks(zone), memory_accesses(zone), alias_checks(zone) {}
+
+    // The header, followed by the body blocks in execution order.
+    ZoneVector<const Block*> blocks;
+    OpIndex induction_phi = OpIndex::Invalid();
+    OpIndex induction_update = OpIndex::Invalid();
+    OpIndex induction_overflow_check = OpIndex::Invalid();
+    OpIndex reduction_phi = OpIndex::Invalid();
+    OpIndex reduction_update = OpIndex::Invalid();
+    OpIndex stack_check = OpIndex::Invalid();
+    // Whether the loop keeps iterating when the header's condition is true.
+    bool continue_if_true = true;
+    bool has_stores = false;
+    bool has_raw_uniform_loads = false;
+    LaneKind lanes = LaneKind::kNone;
+    ZoneVector<OpIndex> memory_accesses;
+    // Pairs of memory accesses that could partially overlap in a vector
+    // iteration, in which case the vector loop exits.
+    ZoneVector<std::pair<OpIndex, OpIndex>> alias_checks;
+
+    const Block* header() const { return blocks.front(); }
+    int lane_count() const { return LaneCount(lanes); }
+  };
+
+  LoopVectorizationAnalyzer(Zone* phase_zone, Graph* input_graph)
+      : phase_zone_(phase_zone),
+        input_graph_(input_graph),
+        matcher_(*input_graph),
+        loop_finder_(phase_zone, input_graph,
+                     {LoopFinder::ConfigFlags::kFindCalls}),
+        op_info_(input_graph->op_id_count(), OpInfo{}, phase_zone,
+                 input_graph),
+        vector_loops_(phase_zone) {
+    DetectVectorizableLoops();
+  }
+
+  bool CanVectorizeAtLeastOneLoop() const { return !vector_loops_.empty(); }
+
+  const VectorLoop* GetVectorLoop(const Block* header) const {
+    auto it = vector_loops_.find(header);
+    if (it == vector_loops_.end()) return nullptr;
+    return &it->second;
+  }
+
+  OpInfo GetOpInfo(OpIndex idx) const { return op_info_[idx]; }
+  OpKind GetOpKind(OpIndex idx) const { return op_info_[idx].kind; }
+
+  static bool IsInLoop(const VectorLoop& loop, OpIndex idx) {
+    for (const Block* block : loop.blocks) {
+      if (block->Contains(idx)) return true;
+    }
+    return false;
+  }
+
+  static int LaneCount(LaneKind lanes) {
+    switch (lanes) {
+      case LaneKind::kI32x4:
+      case LaneKind::kF32x4:
+        return 4;
+      case LaneKind::kF64x2:
+        return 2;
+      case LaneKind::kNone:
+        UNREACHABLE();
+    }
+  }
+
+  static constexpr size_t kMaxLoopSize = 128;
+  static constexpr size_t kMaxLoopBlocks = 8;
+
+ private:
+  void DetectVectorizableLoops();
+  bool TryVectorizeLoop(const Block* header, const LoopFinder::LoopInfo& info,
+                        VectorLoop* loop);
+  bool CollectBlocks(const Block* header, const LoopFinder::LoopInfo& info,
+                     VectorLoop* loop);
+  bool ClassifyPhis(VectorLoop* loop);
+  bool IsInductionUpdate(OpIndex phi, OpIndex update, VectorLoop* loop) const;
+  bool IsReductionUpdate(const PhiOp& phi, OpIndex phi_index,
+                         OpIndex update) const;
+  OpInfo ClassifyOp(VectorLoop* loop, OpIndex idx, const Operation& op);
+  OpInfo ClassifyVectorOp(const VectorLoop& loop, LaneKind lanes,
+                          base::Vector<const OpIndex> inputs) const;
+  OpInfo ClassifyMemoryAccess(VectorLoop* loop, OpIndex idx, OpIndex base,
+                              OptionalOpIndex index,
+                              MemoryRepresentation rep,
+                              uint8_t element_size_log2);
+  bool IsValidStackCheckFrameState(const VectorLoop& loop,
+                                   OpIndex frame_state) const;
+  bool FinalizeLoop(VectorLoop* loop);
+  void ResetLoop(const VectorLoop& loop);
+  OpKind InputKind(const VectorLoop& loop, OpIndex input) const {
+    if (!IsInLoop(loop, input)) return OpKind::kUniform;
+    return op_info_[input].kind;
+  }
+
+  Zone* phase_zone_;
+  Graph* input_graph_;
+  OperationMatcher matcher_;
+  LoopFinder loop_finder_;
+  FixedOpIndexSidetable<OpInfo> op_info_;
+  ZoneUnorderedMap<const Block*, VectorLoop> vector_loops_;
+};
+
+template <class Next>
+class LoopVectorizationReducer : public Next {
+ public:
+  TURBOSHAFT_REDUCER_BOILERPLATE(LoopVectorization)
+
+  using OpKind = LoopVectorizationAnalyzer::OpKind;
+  using LaneKind = LoopVectorizationAnalyzer::LaneKind;
+  using VectorLoop = LoopVectorizationAnalyzer::VectorLoop;
+
+  V<None> REDUCE_INPUT_GRAPH(Goto)(V<None> ig_idx, const GotoOp& gto) {
+    const Block* dst = gto.destination;
+    if (dst->IsLoop() && !gto.is_backedge) {
+      // We emit the vector loop right before the forward edge to the header of
+      // the scalar loop, which then processes the remaining iterations.
+      if (const VectorLoop* loop = analyzer_.GetVectorLoop(dst)) {
+        if (!ShouldSkipOptimizationStep()) EmitVectorLoop(*loop);
+      }
+    }
+    return Next::ReduceInputGraphGoto(ig_idx, gto);
+  }
+
+  OpIndex REDUCE_INPUT_GRAPH(Phi)(OpIndex ig_idx, const PhiOp& phi) {
+    // The loop phis of a vectorized loop start from the values that the vector
+    // loop exited with.
+    for (auto [input_phi, forward_value] : phi_overrides_) {
+      if (input_phi == ig_idx && __ current_block()->IsLoop()) {
+        return __ PendingLoopPhi(forward_value, phi.rep);
+      }
+    }
+    return Next::ReduceInputGraphPhi(ig_idx, phi);
+  }
+
+ private:
+  // Number of vector iterations between two stack checks. Has to be a power
+  // of 2.
+  static constexpr uint32_t kStackCheckInterval = 64;
+  static_assert(base::bits::IsPowerOfTwo(kStackCheckInterval));
+
+  void EmitVectorLoop(const VectorLoop& loop);
+  void EmitChecks(Label<Word32, Simd128>& scalar_loop, V<Simd128> acc);
+  V<Simd128> EmitVectorBody(V<Simd128> acc);
+  void EmitStackCheck(OpIndex reduction_init, V<Simd128> acc);
+  OpIndex EmitFrameState(OpIndex frame_state);
+  OpIndex EmitUniformOp(const Operation& op);
+  OpIndex EmitVectorOp(const Operation& op, LaneKind lanes);
+  OpIndex EmitLinear(OpIndex idx, int lane);
+  V<Word32> EmitLaneCondition(const ComparisonOp& cmp, int lane);
+  V<Word32> EvaluateCondition(OpIndex cond, bool for_all_lanes);
+  V<Simd128> ReductionIdentity();
+  OpIndex ReduceLanes(OpIndex scalar, V<Simd128> acc);
+
+  OpIndex MapScalar(OpIndex idx) {
+    if (!LoopVectorizationAnalyzer::IsInLoop(*loop_, idx)) {
+      return __ MapToNewGraph(idx);
+    }
+    DCHECK_EQ(analyzer_.GetOpKind(idx), OpKind::kUniform);
+    return scalar_values_.at(idx);
+  }
+
+  V<Simd128> MapVector(OpIndex idx, LaneKind lanes) {
+    if (analyzer_.GetOpKind(idx) == OpKind::kVector &&
+        LoopVectorizationAnalyzer::IsInLoop(*loop_, idx)) {
+      return V<Simd128>::Cast(vector_values_.at(idx));
+    }
+    return __ Simd128Splat(V<Any>::Cast(MapScalar(idx)), SplatKind(lanes));
+  }
+
+  V<WordPtr> EmitAddress(OpIndex access) {
+    const Operation& op = __ input_graph().Get(access);
+    if (const LoadOp* load = op.TryCast<LoadOp>()) {
+      return __ WordPtrAdd(V<WordPtr>::Cast(MapScalar(load->base())),
+                           load->offset);
+    }
+    const StoreOp& store = op.Cast<StoreOp>();
+    return __ WordPtrAdd(V<WordPtr>::Cast(MapScalar(store.base())),
+                         store.offset);
+  }
+
+  static Simd128SplatOp::Kind SplatKind(LaneKind lanes) {
+    switch (lanes) {
+      case LaneKind::kI32x4:
+        return Simd128SplatOp::Kind::kI32x4;
+      case LaneKind::kF32x4:
+        return Simd128SplatOp::Kind::kF32x4;
+      case LaneKind::kF64x2:
+        return Simd128SplatOp::Kind::kF64x2;
+      case LaneKind::kNone:
+        UNREACHABLE();
+    }
+  }
+
+  static Simd128ExtractLaneOp::Kind ExtractLaneKind(LaneKind lanes) {
+    switch (lanes) {
+      case LaneKind::kI32x4:
+        return Simd128ExtractLaneOp::Kind::kI32x4;
+      case LaneKind::kF32x4:
+        return Simd128ExtractLaneOp::Kind::kF32x4;
+      case LaneKind::kF64x2:
+        return Simd128ExtractLaneOp::Kind::kF64x2;
+      case LaneKind::kNone:
+        UNREACHABLE();
+    }
+  }
+
+  static Simd128BinopOp::Kind WordBinopKind(WordBinopOp::Kind kind) {
+    switch (kind) {
+      case WordBinopOp::Kind::kAdd:
+        return Simd128BinopOp::Kind::kI32x4Add;
+      case WordBinopOp::Kind::kSub:
+        return Simd128BinopOp::Kind::kI32x4Sub;
+      case WordBinopOp::Kind::kMul:
+        return Simd128BinopOp::Kind::kI32x4Mul;
+      case WordBinopOp::Kind::kBitwiseAnd:
+        return Simd128BinopOp::Kind::kS128And;
+      case WordBinopOp::Kind::kBitwiseOr:
+        return Simd128BinopOp::Kind::kS128Or;
+      case WordBinopOp::Kind::kBitwiseXor:
+        return Simd128BinopOp::Kind::kS128Xor;
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  static Simd128BinopOp::Kind FloatBinopKind(FloatBinopOp::Kind kind,
+                                             LaneKind lanes) {
+    bool f64 = lanes == LaneKind::kF64x2;
+    switch (kind) {
+      case FloatBinopOp::Kind::kAdd:
+        return f64 ? Simd128BinopOp::Kind::kF64x2Add
+                   : Simd128BinopOp::Kind::kF32x4Add;
+      case FloatBinopOp::Kind::kSub:
+        return f64 ? Simd128BinopOp::Kind::kF64x2Sub
+                   : Simd128BinopOp::Kind::kF32x4Sub;
+      case FloatBinopOp::Kind::kMul:
+        return f64 ? Simd128BinopOp::Kind::kF64x2Mul
+                   : Simd128BinopOp::Kind::kF32x4Mul;
+      case FloatBinopOp::Kind::kDiv:
+        return f64 ? Simd128BinopOp::Kind::kF64x2Div
+                   : Simd128BinopOp::Kind::kF32x4Div;
+      // Wasm's min/max have the same NaN and -0 semantics as Math.min/max.
+      case FloatBinopOp::Kind::kMin:
+        return f64 ? Simd128BinopOp::Kind::kF64x2Min
+                   : Simd128BinopOp::Kind::kF32x4Min;
+      case FloatBinopOp::Kind::kMax:
+        return f64 ? Simd128BinopOp::Kind::kF64x2Max
+                   : Simd128BinopOp::Kind::kF32x4Max;
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  static Simd128UnaryOp::Kind FloatUnaryKind(FloatUnaryOp::Kind kind,
+                                             LaneKind lanes) {
+    bool f64 = lanes == LaneKind::kF64x2;
+    switch (kind) {
+      case FloatUnaryOp::Kind::kAbs:
+        return f64 ? Simd128UnaryOp::Kind::kF64x2Abs
+                   : Simd128UnaryOp::Kind::kF32x4Abs;
+      case FloatUnaryOp::Kind::kNegate:
+        return f64 ? Simd128UnaryOp::Kind::kF64x2Neg
+                   : Simd128UnaryOp::Kind::kF32x4Neg;
+      case FloatUnaryOp::Kind::kSqrt:
+        return f64 ? Simd128UnaryOp::Kind::kF64x2Sqrt
+                   : Simd128UnaryOp::Kind::kF32x4Sqrt;
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  static Simd128ShiftOp::Kind ShiftKind(ShiftOp::Kind kind) {
+    switch (kind) {
+      case ShiftOp::Kind::kShiftLeft:
+        return Simd128ShiftOp::Kind::kI32x4Shl;
+      case ShiftOp::Kind::kShiftRightArithmetic:
+      case ShiftOp::Kind::kShiftRightArithmeticShiftOutZeros:
+        return Simd128ShiftOp::Kind::kI32x4ShrS;
+      case ShiftOp::Kind::kShiftRightLogical:
+        return Simd128ShiftOp::Kind::kI32x4ShrU;
+      default:
+        UNREACHABLE();
+    }
+  }
+
+  // The analysis should be ran ahead of time so that the
+  // LoopVectorizationPhase doesn't trigger the CopyingPhase if there are no
+  // loops to vectorize.
+  const LoopVectorizationAnalyzer& analyzer_ =
+      *__ data() -> loop_vectorization_analyzer();
+
+  // State of the vector loop currently being emitted.
+  const VectorLoop* loop_ = nullptr;
+  V<Word32> iv_ = V<Word32>::Invalid();
+  OpIndex reduction_value_ = OpIndex::Invalid();
+  ZoneAbslFlatHashMap<OpIndex, OpIndex> scalar_values_{__ phase_zone()};
+  ZoneAbslFlatHashMap<OpIndex, OpIndex> vector_values_{__ phase_zone()};
+
+  base::SmallVector<std::pair<OpIndex, OpIndex>, 4> phi_overrides_;
+};
+
+template <class Next>
+void LoopVectorizationReducer<Next>::EmitVectorLoop(const VectorLoop& loop) {
+  TRACE("LoopVectorization: vectorizing loop at "
+        << loop.header()->index().id() << " with " << loop.lane_count()
+        << " lanes");
+  loop_ = &loop;
+  const int lanes = loop.lane_count();
+
+  const PhiOp& induction_phi =
+      __ input_graph().Get(loop.induction_phi).template Cast<PhiOp>();
+  V<Word32> iv_init =
+      V<Word32>::Cast(__ MapToNewGraph(induction_phi.forward_edge()));
+  OpIndex reduction_init = OpIndex::Invalid();
+  if (loop.reduction_phi.valid()) {
+    const PhiOp& reduction_phi =
+        __ input_graph().Get(loop.reduction_phi).template Cast<PhiOp>();
+    reduction_init = __ MapToNewGraph(reduction_phi.forward_edge());
+  }
+
+  LoopLabel<Word32, Simd128, Word32> vector_loop(this);
+  Label<Word32, Simd128> scalar_loop(this);
+
+  GOTO(vector_loop, iv_init, ReductionIdentity(), 0);
+
+  BIND_LOOP(vector_loop, iv, acc, budget) {
+    iv_ = iv;
+    scalar_values_.clear();
+    vector_values_.clear();
+
+    // All lanes should be in [0, kMaxInt], so that conversions of the
+    // induction variable are monotonic, and the increment cannot overflow.
+    GOTO_IF_NOT(__ Uint32LessThanOrEqual(
+                    iv, static_cast<uint32_t>(kMaxInt - lanes)),
+                scalar_loop, iv, acc);
+
+    if (loop.stack_check.valid()) {
+      IF (UNLIKELY(__ Word32Equal(budget, 0))) {
+        EmitStackCheck(reduction_init, acc);
+      }
+    }
+
+    EmitChecks(scalar_loop, acc);
+    V<Simd128> next_acc = EmitVectorBody(acc);
+
+    GOTO(vector_loop, __ Word32Add(iv, lanes), next_acc,
+         __ Word32BitwiseAnd(__ Word32Sub(budget, 1),
+                             kStackCheckInterval - 1));
+  }
+
+  BIND(scalar_loop, exit_iv, exit_acc);
+  phi_overrides_.push_back({loop.induction_phi, exit_iv});
+  if (loop.reduction_phi.valid()) {
+    phi_overrides_.push_back(
+        {loop.reduction_phi, ReduceLanes(reduction_init, exit_acc)});
+  }
+  loop_ = nullptr;
+}
+
+template <class Next>
+void LoopVectorizationReducer<Next>::EmitChecks(
+    Label<Word32, Simd128>& scalar_loop, V<Simd128> acc) {
+  // Emits the uniform operations and the checks of all of the lanes of this
+  // vector iteration, in their original order. This all happens before any
+  // vector memory access, so that the scalar loop can redo this iteration
+  // from the start.
+  const Graph& graph = __ input_graph();
+  for (const Block* block : loop_->blocks) {
+    for (OpIndex idx : graph.OperationIndices(*block)) {
+      const Operation& op = graph.Get(idx);
+      switch (analyzer_.GetOpKind(idx)) {
+        case OpKind::kUniform:
+          scalar_values_[idx] = EmitUniformOp(op);
+          break;
+        case OpKind::kWindowCheck: {
+          const DeoptimizeIfOp& deopt = op.Cast<DeoptimizeIfOp>();
+          if (deopt.negated) {
+            GOTO_IF_NOT(EvaluateCondition(deopt.condition(), true),
+                        scalar_loop, iv_, acc);
+          } else {
+            GOTO_IF(EvaluateCondition(deopt.condition(), false), scalar_loop,
+                    iv_, acc);
+          }
+          break;
+        }
+        case OpKind::kControl:
+          if (const BranchOp* branch = op.TryCast<BranchOp>()) {
+            if (loop_->continue_if_true) {
+              GOTO_IF_NOT(EvaluateCondition(branch->condition(), true),
+                          scalar_loop, iv_, acc);
+            } else {
+              GOTO_IF(EvaluateCondition(branch->condition(), false),
+                      scalar_loop, iv_, acc);
+            }
+          }
+          break;
+        default:
+          break;
+      }
+    }
+  }
+
+  // Accesses to different typed arrays can overlap if they share their
+  // buffer. Vectorizing is only correct if they either access the same
+  // addresses, or don't overlap at all in this vector iteration.
+  for (auto [first, second] : loop_->alias_checks) {
+    V<WordPtr> delta =
+        __ WordPtrSub(EmitAddress(first), EmitAddress(second));
+    V<Word32> overlaps = __ Word32BitwiseAnd(
+        __ Word32Equal(__ WordPtrEqual(delta, 0), 0),
+        __ UintPtrLessThan(__ WordPtrAdd(delta, kSimd128Size - 1),
+                           2 * kSimd128Size - 1));
+    GOTO_IF(UNLIKELY(overlaps), scalar_loop, iv_, acc);
+  }
+}
+
+template <class Next>
+V<Simd128> LoopVectorizationReducer<Next>::EmitVectorBody(V<Simd128> acc) {
+  const Graph& graph = __ input_graph();
+  V<Simd128> next_acc = acc;
+  for (const Block* block : loop_->blocks) {
+    for (OpIndex idx : graph.OperationIndices(*block)) {
+      const Operation& op = graph.Get(idx);
+      LoopVectorizationAnalyzer::OpInfo info = analyzer_.GetOpInfo(idx);
+      switch (info.kind) {
+        case OpKind::kVector:
+          vector_values_[idx] = EmitVectorOp(op, info.lanes);
+          break;
+        case OpKind::kReduction: {
+          OpIndex value = op.input(0) == loop_->reduction_phi ? op.input(1)
+                                                              : op.input(0);
+          Simd128BinopOp::Kind kind =
+              op.Is<WordBinopOp>()
+                  ? WordBinopKind(op.Cast<WordBinopOp>().kind)
+                  : FloatBinopKind(op.Cast<FloatBinopOp>().kind, info.lanes);
+          next_acc =
+              __ Simd128Binop(acc, MapVector(value, info.lanes), kind);
+          break;
+        }
+        case OpKind::kRetain:
+          __ Retain(V<Object>::Cast(MapScalar(op.input(0))));
+          break;
+        default:
+          break;
+      }
+    }
+  }
+  return next_acc;
+}
+
+template <class Next>
+void LoopVectorizationReducer<Next>::EmitStackCheck(OpIndex reduction_init,
+                                                    V<Simd128> acc) {
+  const JSStackCheckOp& check =
+      __ input_graph().Get(loop_->stack_check).template Cast<JSStackCheckOp>();
+  reduction_value_ = loop_->reduction_phi.valid()
+                         ? ReduceLanes(reduction_init, acc)
+                         : OpIndex::Invalid();
+  OpIndex frame_state = EmitFrameState(check.frame_state().value());
+  __ JSLoopStackCheck(V<Context>::Cast(MapScalar(check.native_context())),
+                      V<LazyFrameState>::Cast(frame_state));
+}
+
+template <class Next>
+OpIndex LoopVectorizationReducer<Next>::EmitFrameState(OpIndex frame_state) {
+  if (!LoopVectorizationAnalyzer::IsInLoop(*loop_, frame_state)) {
+    return __ MapToNewGraph(frame_state);
+  }
+  // The stack check happens between two iterations of the scalar loop: the
+  // induction variable and the reduction (or their next values, depending on
+  // where the stack check is) are the ones this vector iteration starts with.
+  const FrameStateOp& op =
+      __ input_graph().Get(frame_state).template Cast<FrameStateOp>();
+  base::SmallVector<OpIndex, 32> inputs;
+  for (OpIndex input : op.inputs()) {
+    if (input == loop_->induction_phi || input == loop_->induction_update) {
+      inputs.push_back(iv_);
+    } else if (input == loop_->reduction_phi ||
+               input == loop_->reduction_update) {
+      inputs.push_back(reduction_value_);
+    } else {
+      inputs.push_back(EmitFrameState(input));
+    }
+  }
+  return __ template FrameState<LazyFrameState>(base::VectorOf(inputs),
+                                                op.inlined, op.data);
+}
+
+template <class Next>
+OpIndex LoopVectorizationReducer<Next>::EmitUniformOp(const Operation& op) {
+  if (__ generating_unreachable_operations()) return OpIndex::Invalid();
+  switch (op.opcode) {
+    case Opcode::kConstant: {
+      const ConstantOp& c = op.Cast<ConstantOp>();
+      return __ ReduceConstant(c.kind, c.storage);
+    }
+    case Opcode::kWordBinop: {
+      const WordBinopOp& binop = op.Cast<WordBinopOp>();
+      return __ WordBinop(V<Word>::Cast(MapScalar(binop.left())),
+                          V<Word>::Cast(MapScalar(binop.right())), binop.kind,
+                          binop.rep);
+    }
+    case Opcode::kShift: {
+      const ShiftOp& shift = op.Cast<ShiftOp>();
+      return __ Shift(V<Word>::Cast(MapScalar(shift.left())),
+                      V<Word32>::Cast(MapScalar(shift.right())), shift.kind,
+                      shift.rep);
+    }
+    case Opcode::kComparison: {
+      const ComparisonOp& cmp = op.Cast<ComparisonOp>();
+      return __ Comparison(MapScalar(cmp.left()), MapScalar(cmp.right()),
+                           cmp.kind, cmp.rep);
+    }
+    case Opcode::kChange: {
+      const ChangeOp& change = op.Cast<ChangeOp>();
+      return __ ReduceChange(V<Untagged>::Cast(MapScalar(change.input())),
+                             change.kind, change.assumption, change.from,
+                             change.to);
+    }
+    case Opcode::kTaggedBitcast: {
+      const TaggedBitcastOp& cast = op.Cast<TaggedBitcastOp>();
+      return __ TaggedBitcast(MapScalar(cast.input()), cast.from, cast.to,
+                              cast.kind);
+    }
+    case Opcode::kFloatBinop: {
+      const FloatBinopOp& binop = op.Cast<FloatBinopOp>();
+      return __ ReduceFloatBinop(V<Float>::Cast(MapScalar(binop.left())),
+                                 V<Float>::Cast(MapScalar(binop.right())),
+                                 binop.kind, binop.rep);
+    }
+    case Opcode::kFloatUnary: {
+      const FloatUnaryOp& unary = op.Cast<FloatUnaryOp>();
+      return __ FloatUnary(V<Float>::Cast(MapScalar(unary.input())),
+                           unary.kind, unary.rep);
+    }
+    case Opcode::kLoad: {
+      const LoadOp& load = op.Cast<LoadOp>();
+      OptionalOpIndex index = OpIndex::Invalid();
+      if (load.index().has_value()) index = MapScalar(load.index().value());
+      return __ Load(MapScalar(load.base()), index, load.kind, load.loaded_rep,
+                     load.result_rep, load.offset, load.element_size_log2);
+    }
+    default:
+      UNREACHABLE();
+  }
+}
+
+template <class Next>
+OpIndex LoopVectorizationReducer<Next>::EmitVectorOp(const Operation& op,
+                                                     LaneKind lanes) {
+  if (__ generating_unreachable_operations()) return OpIndex::Invalid();
+  switch (op.opcode) {
+    case Opcode::kLoad: {
+      // Typed array accesses are indexed by a conversion of the induction
+      // variable: the access of the first lane is the address of the vector.
+      const LoadOp& load = op.Cast<LoadOp>();
+      return __ Load(MapScalar(load.base()),
+                     EmitLinear(load.index().value(), 0), load.kind,
+                     MemoryRepresentation::Simd128(),
+                     RegisterRepresentation::Simd128(), load.offset,
+                     load.element_size_log2);
+    }
+    case Opcode::kStore: {
+      const StoreOp& store = op.Cast<StoreOp>();
+      __ Store(MapScalar(store.base()), EmitLinear(store.index().value(), 0),
+               MapVector(store.value(), lanes), store.kind,
+               MemoryRepresentation::Simd128(), store.write_barrier,
+               store.offset, store.element_size_log2);
+      return OpIndex::Invalid();
+    }
+    case Opcode::kWordBinop: {
+      const WordBinopOp& binop = op.Cast<WordBinopOp>();
+      return __ Simd128Binop(MapVector(binop.left(), lanes),
+                             MapVector(binop.right(), lanes),
+                             WordBinopKind(binop.kind));
+    }
+    case Opcode::kShift: {
+      const ShiftOp& shift = op.Cast<ShiftOp>();
+      return __ Simd128Shift(MapVector(shift.left(), lanes),
+                             V<Word32>::Cast(MapScalar(shift.right())),
+                             ShiftKind(shift.kind));
+    }
+    case Opcode::kFloatBinop: {
+      const FloatBinopOp& binop = op.Cast<FloatBinopOp>();
+      return __ Simd128Binop(MapVector(binop.left(), lanes),
+                             MapVector(binop.right(), lanes),
+                             FloatBinopKind(binop.kind, lanes));
+    }
+    case Opcode::kFloatUnary: {
+      const FloatUnaryOp& unary = op.Cast<FloatUnaryOp>();
+      return __ Simd128Unary(MapVector(unary.input(), lanes),
+                             FloatUnaryKind(unary.kind, lanes));
+    }
+    default:
+      UNREACHABLE();
+  }
+}
+
+template <class Next>
+OpIndex LoopVectorizationReducer<Next>::EmitLinear(OpIndex idx, int lane) {
+  if (__ generating_unreachable_operations()) return OpIndex::Invalid();
+  if (idx == loop_->induction_phi) {
+    return lane == 0 ? iv_ : __ Word32Add(iv_, lane);
+  }
+  DCHECK_EQ(analyzer_.GetOpKind(idx), OpKind::kLinear);
+  const ChangeOp& change = __ input_graph().Get(idx).template Cast<ChangeOp>();
+  OpIndex input = EmitLinear(change.input(), lane);
+  if (__ generating_unreachable_operations()) return OpIndex::Invalid();
+  return __ ReduceChange(V<Untagged>::Cast(input), change.kind,
+                         change.assumption, change.from, change.to);
+}
+
+template <class Next>
+V<Word32> LoopVectorizationReducer<Next>::EmitLaneCondition(
+    const ComparisonOp& cmp, int lane) {
+  auto emit_input = [&](OpIndex input) {
+    if (LoopVectorizationAnalyzer::IsInLoop(*loop_, input) &&
+        analyzer_.GetOpKind(input) == OpKind::kLinear) {
+      return EmitLinear(input, lane);
+    }
+    return MapScalar(input);
+  };
+  return __ Comparison(emit_input(cmp.left()), emit_input(cmp.right()),
+                       cmp.kind, cmp.rep);
+}
+
+template <class Next>
+V<Word32> LoopVectorizationReducer<Next>::EvaluateCondition(
+    OpIndex cond, bool for_all_lanes) {
+  if (analyzer_.GetOpKind(cond) != OpKind::kLaneCondition ||
+      !LoopVectorizationAnalyzer::IsInLoop(*loop_, cond)) {
+    return V<Word32>::Cast(MapScalar(cond));
+  }
+  // Conversions of the induction variable are monotonic over the lanes, so
+  // `linear < uniform` holds for a prefix of the lanes, and `uniform < linear`
+  // for a suffix. It is thus enough to check the first or the last lane.
+  const ComparisonOp& cmp =
+      __ input_graph().Get(cond).template Cast<ComparisonOp>();
+  bool holds_on_prefix = LoopVectorizationAnalyzer::IsInLoop(
+                             *loop_, cmp.left()) &&
+                         analyzer_.GetOpKind(cmp.left()) == OpKind::kLinear;
+  int lane = holds_on_prefix == for_all_lanes ? loop_->lane_count() - 1 : 0;
+  return EmitLaneCondition(cmp, lane);
+}
+
+template <class Next>
+V<Simd128> LoopVectorizationReducer<Next>::ReductionIdentity() {
+  uint8_t bytes[kSimd128Size] = {0};
+  if (!loop_->reduction_phi.valid()) return __ Simd128Constant(bytes);
+
+  const Operation& update = __ input_graph().Get(loop_->reduction_update);
+  auto fill = [&](auto value) {
+    for (size_t i = 0; i < kSimd128Size; i += sizeof(value)) {
+      std::memcpy(bytes + i, &value, sizeof(value));
+    }
+  };
+  if (const WordBinopOp* binop = update.TryCast<WordBinopOp>()) {
+    switch (binop->kind) {
+      case WordBinopOp::Kind::kMul:
+        fill(int32_t{1});
+        break;
+      case WordBinopOp::Kind::kBitwiseAnd:
+        fill(int32_t{-1});
+        break;
+      default:
+        // Add, Or and Xor.
+        break;
+    }
+  } else {
+    const FloatBinopOp& binop = update.Cast<FloatBinopOp>();
+    bool is_min = binop.kind == FloatBinopOp::Kind::kMin;
+    if (binop.rep == FloatRepresentation::Float64()) {
+      fill(is_min ? std::numeric_limits<double>::infinity()
+                  : -std::numeric_limits<double>::infinity());
+    } else {
+      fill(is_min ? std::numeric_limits<float>::infinity()
+                  : -std::numeric_limits<float>::infinity());
+    }
+  }
+  return __ Simd128Constant(bytes);
+}
+
+template <class Next>
+OpIndex LoopVectorizationReducer<Next>::ReduceLanes(OpIndex scalar,
+                                                    V<Simd128> acc) {
+  // The reduction operations are associative and commutative, so the lanes
+  // can be combined in any order.
+  if (__ generating_unreachable_operations()) return OpIndex::Invalid();
+  const Operation& update = __ input_graph().Get(loop_->reduction_update);
+  LaneKind lanes = loop_->lanes;
+  for (int lane = 0; lane < loop_->lane_count(); lane++) {
+    OpIndex value = __ Simd128ExtractLane(acc, ExtractLaneKind(lanes), lane);
+    if (const WordBinopOp* binop = update.TryCast<WordBinopOp>()) {
+      scalar = __ WordBinop(V<Word>::Cast(scalar), V<Word>::Cast(value),
+                            binop->kind, binop->rep);
+    } else {
+      const FloatBinopOp& binop = update.Cast<FloatBinopOp>();
+      scalar = __ ReduceFloatBinop(V<Float>::Cast(scalar),
+                                   V<Float>::Cast(value), binop.kind,
+                                   binop.rep);
+    }
+  }
+  return scalar;
+}
+
+#undef TRACE
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
+
+#endif  // V8_COMPILER_TURBOSHAFT_LOOP_VECTORIZATION_REDUCER_H_
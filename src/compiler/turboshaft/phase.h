@@ -182,6 +182,7 @@ struct produces_printable_graph
 enum class TurboshaftPipelineKind { kJS, kWasm, kCSA, kTSABuiltin, kJSToWasm };
 
 class LoopUnrollingAnalyzer;
+class LoopVectorizationAnalyzer;
 class WasmRevecAnalyzer;
 class WasmShuffleAnalyzer;
 
@@ -422,6 +423,22 @@ class V8_EXPORT_PRIVATE PipelineData {
   const Linkage* linkage() const { return linkage_; }
   void set_linkage(const Linkage* linkage) { linkage_ = linkage; }
 
+#if V8_ENABLE_SIMD128
+  LoopVectorizationAnalyzer* loop_vectorization_analyzer() const {
+    DCHECK_NOT_NULL(loop_vectorization_analyzer_);
+    return loop_vectorization_analyzer_;
+  }
+
+  void set_loop_vectorization_analyzer(LoopVectorizationAnalyzer* analyzer) {
+    DCHECK_NULL(loop_vectorization_analyzer_);
+    loop_vectorization_analyzer_ = analyzer;
+  }
+
+  void clear_loop_vectorization_analyzer() {
+    loop_vectorization_analyzer_ = nullptr;
+  }
+#endif  // V8_ENABLE_SIMD128
+
 #if V8_ENABLE_WEBASSEMBLY
   // Module-specific signature: type indices are only valid in the WasmModule*
   // they belong to.
@@ -590,6 +607,10 @@ class V8_EXPORT_PRIVATE PipelineData {
   std::optional<InstructionComponent> instruction_component_;
   std::optional<RegisterComponent> register_component_;
 
+#if V8_ENABLE_SIMD128
+  LoopVectorizationAnalyzer* loop_vectorization_analyzer_ = nullptr;
+#endif  // V8_ENABLE_SIMD128
+
 #if V8_ENABLE_WEBASSEMBLY
   // TODO(14108): Consider splitting wasm members into its own WasmPipelineData
   // if we need many of them.
@@ -24,6 +24,7 @@
 #include "src/compiler/turboshaft/loop-optimization-phase.h"
 #include "src/compiler/turboshaft/loop-peeling-phase.h"
 #include "src/compiler/turboshaft/loop-unrolling-phase.h"
+#include "src/compiler/turboshaft/loop-vectorization-phase.h"
 #include "src/compiler/turboshaft/machine-lowering-phase.h"
 #include "src/compiler/turboshaft/memory-optimization-phase.h"
 #include "src/compiler/turboshaft/phase.h"
@@ -229,6 +230,10 @@ class V8_EXPORT_PRIVATE Pipeline {
 
     RUN_MAYBE_ABORT(turboshaft::MachineLoweringPhase);
 
+    if (V8_UNLIKELY(v8_flags.turboshaft_loop_vectorization)) {
+      RUN_MAYBE_ABORT(turboshaft::LoopVectorizationPhase);
+    }
+
     if (v8_flags.turboshaft_loop_unrolling) {
       RUN_MAYBE_ABORT(turboshaft::LoopUnrollingPhase);
     }
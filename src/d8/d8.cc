@@ -47,6 +47,7 @@
 #include "src/base/hashing.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/platform.h"
 #include "src/base/platform/time.h"
@@ -69,6 +70,7 @@
 #include "src/flags/flags.h"
 #include "src/handles/maybe-handles.h"
 #include "src/heap/parked-scope-inl.h"
+#include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/counters.h"
@@ -5509,6 +5511,8 @@ void Shell::OnExit(v8::Isolate* isolate, bool dispose) {
     // main thread tries to terminate all workers at the end, which can happen
     // concurrently to Isolate::Dispose.
     worker->EnterTerminatedState();
+  } else if (options.dump_startup_timeline) {
+    DumpStartupTimeline(isolate);
   }
 
   if (dispose) {
@@ -5553,6 +5557,21 @@ void Shell::OnExit(v8::Isolate* isolate, bool dispose) {
   }
 }
 
+void Shell::DumpStartupTimeline(Isolate* isolate) {
+  StartupStatistics statistics;
+  if (!isolate->GetStartupStatistics(&statistics)) return;
+  // Emitted as a single JSON object so that benchmark runners can parse it.
+  printf("{\"startup_timeline\": [");
+  for (size_t i = 0; i < statistics.phase_count(); i++) {
+    printf(
+        "%s\n  {\"name\": \"%s\", \"start_ms\": %.3f, \"duration_ms\": "
+        "%.3f}",
+        i == 0 ? "" : ",", statistics.phase_name(i),
+        statistics.phase_start_ms(i), statistics.phase_duration_ms(i));
+  }
+  printf("\n]}\n");
+}
+
 void Shell::DumpCounters() {
   base::MutexGuard mutex_guard(&counter_mutex_);
   std::vector<std::pair<std::string, Counter*>> counters(counter_map_->begin(),
@@ -7039,6 +7058,10 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.dump_counters_nvp = true;
     } else if (FlagMatches("--dump-system-memory-stats", &argv[i])) {
       options.dump_system_memory_stats = true;
+    } else if (FlagMatches("--profile-isolate-creation", &argv[i])) {
+      options.profile_isolate_creation = true;
+    } else if (FlagMatches("--dump-startup-timeline", &argv[i])) {
+      options.dump_startup_timeline = true;
     } else if (FlagWithArgMatches("--icu-data-file", &flag_value, argc, argv,
                                   &i)) {
       options.icu_data_file = flag_value;
@@ -8167,7 +8190,22 @@ int Shell::Main(int argc, char* argv[]) {
             "security will suffer.\n");
   }
 
+  base::ElapsedTimer isolate_creation_timer;
+  const int peak_memory_usage_before_isolate =
+      base::OS::GetPeakMemoryUsageKb();
+  if (options.profile_isolate_creation) isolate_creation_timer.Start();
   Isolate* isolate = Isolate::New(create_params);
+  if (options.profile_isolate_creation) {
+    // Peak RSS is the only memory measure available on all platforms; it grows
+    // by what creating the isolate touched beyond what startup already did.
+    const int peak_memory_usage = base::OS::GetPeakMemoryUsageKb();
+    printf(
+        "[Isolate creation took %0.3f ms, peak RSS %d kb (+%d kb), snapshot "
+        "blob %s]\n",
+        isolate_creation_timer.Elapsed().InMillisecondsF(), peak_memory_usage,
+        peak_memory_usage - peak_memory_usage_before_isolate,
+        i::IsExternalStartupDataMapped() ? "mapped" : "not mapped");
+  }
 
 #ifdef V8_FUZZILLI
 
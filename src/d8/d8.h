@@ -545,6 +545,10 @@ class ShellOptions {
   DisallowReassignment<bool> dump_counters_nvp = {"dump-counters-nvp", false};
   DisallowReassignment<bool> dump_system_memory_stats = {
       "dump-system-memory-stats", false};
+  DisallowReassignment<bool> profile_isolate_creation = {
+      "profile-isolate-creation", false};
+  DisallowReassignment<bool> dump_startup_timeline = {"dump-startup-timeline",
+                                                     false};
   DisallowReassignment<bool> ignore_unhandled_promises = {
       "ignore-unhandled-promises", false};
   DisallowReassignment<bool> mock_arraybuffer_allocator = {
@@ -680,6 +684,7 @@ class Shell : public i::AllStatic {
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate, bool dispose);
   static void DumpCounters();
+  static void DumpStartupTimeline(Isolate* isolate);
   static void CollectGarbage(Isolate* isolate);
   static bool EmptyMessageQueues(Isolate* isolate);
   static bool CompleteMessageLoop(Isolate* isolate);
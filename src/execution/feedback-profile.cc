@@ -0,0 +1,332 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/feedback-profile.h"
+
+#include <algorithm>
+#include <limits>
+#include <optional>
+
+#include "src/base/vlq.h"
+#include "src/execution/isolate.h"
+#include "src/heap/heap-inl.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+#include "src/snapshot/snapshot-utils.h"
+#include "src/utils/version.h"
+
+namespace v8::internal {
+
+namespace {
+
+constexpr uint32_t kMagicNumber = 0xFEEDBAC4;
+
+std::optional<uint32_t> SourceChecksum(Tagged<Script> script) {
+  DisallowGarbageCollection no_gc;
+  if (!IsString(script->source())) return {};
+  Tagged<String> source = Cast<String>(script->source());
+  const uint32_t length = source->length();
+  // Hash the source as two-byte characters, so that the checksum does not
+  // depend on how the source string happens to be represented.
+  std::unique_ptr<base::uc16[]> buffer(new base::uc16[length]);
+  String::WriteToFlat(source, buffer.get(), 0, length);
+  return Checksum(base::Vector<const uint8_t>(
+      reinterpret_cast<const uint8_t*>(buffer.get()),
+      length * sizeof(base::uc16)));
+}
+
+bool IsAccumulatedKind(FeedbackSlotKind kind) {
+  return kind == FeedbackSlotKind::kBinaryOp ||
+         kind == FeedbackSlotKind::kStringAddAndInternalize ||
+         kind == FeedbackSlotKind::kCompareOp ||
+         kind == FeedbackSlotKind::kForIn;
+}
+
+bool IsKeyedPropertyAccessKind(FeedbackSlotKind kind) {
+  return IsKeyedLoadICKind(kind) || IsKeyedHasICKind(kind) ||
+         IsKeyedStoreICKind(kind) || IsDefineKeyedOwnICKind(kind);
+}
+
+bool IsPropertyAccessKind(FeedbackSlotKind kind) {
+  return IsLoadICKind(kind) || IsSetNamedICKind(kind) ||
+         IsDefineNamedOwnICKind(kind) || IsKeyedPropertyAccessKind(kind);
+}
+
+// Returns the heap-independent part of the feedback in {nexus}, if any.
+std::optional<uint32_t> ProfiledValue(FeedbackNexus& nexus) {
+  const FeedbackSlotKind kind = nexus.kind();
+  if (IsAccumulatedKind(kind)) {
+    const int feedback = nexus.GetAccumulatedFeedback();
+    if (feedback == 0) return {};
+    return static_cast<uint32_t>(feedback);
+  }
+  if (IsCallICKind(kind)) {
+    const int call_count = nexus.GetCallCount();
+    if (call_count == 0) return {};
+    return static_cast<uint32_t>(call_count);
+  }
+  if (IsPropertyAccessKind(kind) && nexus.IsMegamorphic()) {
+    return static_cast<uint32_t>(IsKeyedPropertyAccessKind(kind)
+                                     ? nexus.GetKeyType()
+                                     : IcCheckType::kProperty);
+  }
+  return {};
+}
+
+// Whether {value} could have been returned by ProfiledValue for {kind}.
+bool IsValidProfiledValue(FeedbackSlotKind kind, uint32_t value) {
+  switch (kind) {
+    case FeedbackSlotKind::kBinaryOp:
+    case FeedbackSlotKind::kStringAddAndInternalize:
+      return (value & ~BinaryOperationFeedback::kAny) == 0;
+    case FeedbackSlotKind::kCompareOp:
+      return (value & ~CompareOperationFeedback::kAny) == 0;
+    case FeedbackSlotKind::kForIn:
+      return (value & ~static_cast<uint32_t>(ForInFeedback::kAny)) == 0;
+    default:
+      break;
+  }
+  if (IsCallICKind(kind)) {
+    return value <= static_cast<uint32_t>(std::numeric_limits<int32_t>::max());
+  }
+  if (IsPropertyAccessKind(kind)) {
+    return value == static_cast<uint32_t>(IcCheckType::kProperty) ||
+           value == static_cast<uint32_t>(IcCheckType::kElement);
+  }
+  return false;
+}
+
+uint32_t SaturatingAdd(uint32_t a, uint32_t b) {
+  const uint32_t max = std::numeric_limits<int32_t>::max();
+  return std::min(max, std::min(a, max) + std::min(b, max));
+}
+
+class ProfileReader {
+ public:
+  explicit ProfileReader(base::Vector<const uint8_t> data) : data_(data) {}
+
+  uint32_t Read() {
+    return base::VLQDecodeUnsigned([this]() -> uint8_t {
+      if (position_ == data_.size()) {
+        failed_ = true;
+        return 0;
+      }
+      return data_[position_++];
+    });
+  }
+
+  base::Vector<const uint8_t> Rest() const { return data_ + position_; }
+  bool failed() const { return failed_; }
+  bool done() const { return position_ == data_.size(); }
+
+ private:
+  const base::Vector<const uint8_t> data_;
+  size_t position_ = 0;
+  bool failed_ = false;
+};
+
+}  // namespace
+
+// static
+std::vector<uint8_t> FeedbackProfile::Serialize(Isolate* isolate) {
+  std::map<Key, FunctionProfile> functions;
+  std::unordered_map<int, std::optional<uint32_t>> checksums;
+  {
+    HeapObjectIterator iterator(isolate->heap());
+    DisallowGarbageCollection no_gc;
+    for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!IsFeedbackVector(obj)) continue;
+      Tagged<FeedbackVector> vector = Cast<FeedbackVector>(obj);
+      Tagged<SharedFunctionInfo> shared = vector->shared_function_info();
+      if (!shared->IsSubjectToDebugging()) continue;
+      if (shared->StartPosition() < 0) continue;
+
+      Tagged<Script> script = Cast<Script>(shared->script());
+      auto checksum = checksums.find(script->id());
+      if (checksum == checksums.end()) {
+        checksum =
+            checksums.emplace(script->id(), SourceChecksum(script)).first;
+      }
+      if (!checksum->second.has_value()) continue;
+
+      // Closures of the same function, or of the same script loaded more than
+      // once, are merged into one profile.
+      FunctionProfile& profile =
+          functions[{checksum->second.value(), shared->StartPosition()}];
+      const uint32_t slot_count = vector->length().value();
+      if (profile.slot_count == 0) {
+        profile.slot_count = slot_count;
+      } else if (profile.slot_count != slot_count) {
+        continue;
+      }
+      profile.invocation_count = SaturatingAdd(
+          profile.invocation_count, vector->invocation_count(kRelaxedLoad));
+      if (profile.tiering_decision == CachedTieringDecision::kPending) {
+        profile.tiering_decision = shared->cached_tiering_decision();
+      }
+
+      FeedbackMetadataIterator slots(vector->metadata(), no_gc);
+      while (slots.HasNext()) {
+        const FeedbackSlot slot = slots.Next();
+        FeedbackNexus nexus(isolate, vector, slot);
+        std::optional<uint32_t> value = ProfiledValue(nexus);
+        if (!value.has_value()) continue;
+        const uint32_t index = static_cast<uint32_t>(slot.ToInt());
+        auto entry = std::find_if(
+            profile.slots.begin(), profile.slots.end(),
+            [index](const SlotFeedback& entry) { return entry.slot == index; });
+        if (entry == profile.slots.end()) {
+          profile.slots.push_back({index, nexus.kind(), value.value()});
+        } else if (IsAccumulatedKind(entry->kind)) {
+          entry->value |= value.value();
+        } else if (IsCallICKind(entry->kind)) {
+          entry->value = SaturatingAdd(entry->value, value.value());
+        }
+      }
+    }
+  }
+
+  // Functions that have not run yet carry no information.
+  std::erase_if(functions, [](const auto& function) {
+    const FunctionProfile& profile = function.second;
+    return profile.invocation_count == 0 && profile.slots.empty() &&
+           profile.tiering_decision == CachedTieringDecision::kPending;
+  });
+
+  std::vector<uint8_t> payload;
+  base::VLQEncodeUnsigned(&payload, static_cast<uint32_t>(functions.size()));
+  for (const auto& [key, profile] : functions) {
+    base::VLQEncodeUnsigned(&payload, key.first);
+    base::VLQEncodeUnsigned(&payload, static_cast<uint32_t>(key.second));
+    base::VLQEncodeUnsigned(&payload, profile.slot_count);
+    base::VLQEncodeUnsigned(&payload, profile.invocation_count);
+    base::VLQEncodeUnsigned(&payload,
+                            static_cast<uint32_t>(profile.tiering_decision));
+    base::VLQEncodeUnsigned(&payload,
+                            static_cast<uint32_t>(profile.slots.size()));
+    for (const SlotFeedback& entry : profile.slots) {
+      base::VLQEncodeUnsigned(&payload, entry.slot);
+      base::VLQEncodeUnsigned(&payload, static_cast<uint32_t>(entry.kind));
+      base::VLQEncodeUnsigned(&payload, entry.value);
+    }
+  }
+
+  std::vector<uint8_t> data;
+  base::VLQEncodeUnsigned(&data, kMagicNumber);
+  base::VLQEncodeUnsigned(&data, Version::Hash());
+  base::VLQEncodeUnsigned(&data, Checksum(base::VectorOf(payload)));
+  data.insert(data.end(), payload.begin(), payload.end());
+  return data;
+}
+
+// static
+std::unique_ptr<FeedbackProfile> FeedbackProfile::Deserialize(
+    base::Vector<const uint8_t> data) {
+  ProfileReader header(data);
+  if (header.Read() != kMagicNumber) return {};
+  if (header.Read() != Version::Hash()) return {};
+  const uint32_t checksum = header.Read();
+  if (header.failed() || Checksum(header.Rest()) != checksum) return {};
+
+  ProfileReader reader(header.Rest());
+  std::unique_ptr<FeedbackProfile> result(new FeedbackProfile());
+  const uint32_t function_count = reader.Read();
+  for (uint32_t i = 0; i < function_count && !reader.failed(); i++) {
+    const uint32_t source_checksum = reader.Read();
+    const uint32_t start_position = reader.Read();
+    if (start_position > static_cast<uint32_t>(kMaxInt)) return {};
+    FunctionProfile& profile =
+        result->functions_[{source_checksum,
+                            static_cast<int>(start_position)}];
+    profile.slot_count = reader.Read();
+    profile.invocation_count = reader.Read();
+    if (profile.invocation_count >
+        static_cast<uint32_t>(std::numeric_limits<int32_t>::max())) {
+      return {};
+    }
+    const uint32_t tiering_decision = reader.Read();
+    if (tiering_decision >
+        static_cast<uint32_t>(CachedTieringDecision::kNormal)) {
+      return {};
+    }
+    profile.tiering_decision =
+        static_cast<CachedTieringDecision>(tiering_decision);
+    const uint32_t slot_count = reader.Read();
+    if (slot_count > profile.slot_count) return {};
+    profile.slots.reserve(slot_count);
+    for (uint32_t j = 0; j < slot_count && !reader.failed(); j++) {
+      const uint32_t slot = reader.Read();
+      const uint32_t kind = reader.Read();
+      const uint32_t value = reader.Read();
+      if (slot >= profile.slot_count ||
+          kind > static_cast<uint32_t>(FeedbackSlotKind::kLast) ||
+          !IsValidProfiledValue(static_cast<FeedbackSlotKind>(kind), value)) {
+        return {};
+      }
+      profile.slots.push_back(
+          {slot, static_cast<FeedbackSlotKind>(kind), value});
+    }
+  }
+  if (reader.failed() || !reader.done()) return {};
+  return result;
+}
+
+const FeedbackProfile::FunctionProfile* FeedbackProfile::Lookup(
+    Tagged<SharedFunctionInfo> shared) {
+  if (!shared->IsSubjectToDebugging()) return nullptr;
+  Tagged<Script> script = Cast<Script>(shared->script());
+  auto checksum = source_checksums_.find(script->id());
+  if (checksum == source_checksums_.end()) {
+    std::optional<uint32_t> source_checksum = SourceChecksum(script);
+    if (!source_checksum.has_value()) return nullptr;
+    checksum =
+        source_checksums_.emplace(script->id(), source_checksum.value()).first;
+  }
+  auto it = functions_.find({checksum->second, shared->StartPosition()});
+  if (it == functions_.end()) return nullptr;
+  return &it->second;
+}
+
+void FeedbackProfile::ApplyTieringDecision(Isolate* isolate,
+                                           Tagged<SharedFunctionInfo> shared) {
+  DisallowGarbageCollection no_gc;
+  if (!v8_flags.profile_guided_optimization) return;
+  if (shared->cached_tiering_decision() != CachedTieringDecision::kPending) {
+    return;
+  }
+  const FunctionProfile* profile = Lookup(shared);
+  if (profile == nullptr) return;
+  shared->set_cached_tiering_decision(profile->tiering_decision);
+}
+
+void FeedbackProfile::ApplyFeedback(Isolate* isolate,
+                                    Tagged<FeedbackVector> vector) {
+  DisallowGarbageCollection no_gc;
+  const FunctionProfile* profile = Lookup(vector->shared_function_info());
+  if (profile == nullptr) return;
+
+  // The bytecode, and with it the feedback layout, can differ between
+  // processes, e.g. if flags changed. Only apply feedback that still fits.
+  if (profile->slot_count != vector->length().value()) return;
+  for (const SlotFeedback& entry : profile->slots) {
+    if (vector->GetKind(FeedbackSlot(entry.slot)) != entry.kind) return;
+  }
+
+  vector->set_invocation_count(static_cast<int32_t>(profile->invocation_count),
+                               kRelaxedStore);
+  for (const SlotFeedback& entry : profile->slots) {
+    FeedbackNexus nexus(isolate, vector, FeedbackSlot(entry.slot));
+    if (IsAccumulatedKind(entry.kind)) {
+      nexus.AccumulateFeedback(static_cast<int>(entry.value));
+    } else if (IsCallICKind(entry.kind)) {
+      nexus.SetCallCount(entry.value);
+    } else if (IsPropertyAccessKind(entry.kind)) {
+      nexus.ConfigureMegamorphic(static_cast<IcCheckType>(entry.value));
+    }
+  }
+}
+
+}  // namespace v8::internal
@@ -0,0 +1,90 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_FEEDBACK_PROFILE_H_
+#define V8_EXECUTION_FEEDBACK_PROFILE_H_
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "src/base/vector.h"
+#include "src/common/globals.h"
+#include "src/objects/tagged.h"
+
+namespace v8::internal {
+
+class FeedbackVector;
+class Isolate;
+class SharedFunctionInfo;
+enum class FeedbackSlotKind : uint8_t;
+
+// Type feedback and tiering decisions of JavaScript functions, carried over
+// from one process to the next so that functions of the same scripts start
+// with warm feedback vectors instead of collecting the feedback again.
+// Functions are identified by a checksum of their script's source and their
+// start position in it.
+//
+// Maps, call targets and other heap objects cannot outlive the process, so
+// only feedback that is independent of the heap is kept: the accumulated
+// bits of binary operation, comparison and for-in ICs, call counts,
+// megamorphic property accesses, invocation counts and the cached tiering
+// decision of the function.
+class FeedbackProfile final {
+ public:
+  // Collects the profile of all user-visible functions with a feedback vector
+  // in the heap of {isolate}.
+  static std::vector<uint8_t> Serialize(Isolate* isolate);
+
+  // Returns null if {data} is malformed or was produced by another V8 version.
+  static std::unique_ptr<FeedbackProfile> Deserialize(
+      base::Vector<const uint8_t> data);
+
+  FeedbackProfile(const FeedbackProfile&) = delete;
+  FeedbackProfile& operator=(const FeedbackProfile&) = delete;
+
+  // Lets {shared} skip the tiering decisions it already made in the profiled
+  // process. Called when {shared} is compiled to bytecode.
+  void ApplyTieringDecision(Isolate* isolate,
+                            Tagged<SharedFunctionInfo> shared);
+
+  // Merges the profiled feedback into the freshly allocated {vector}. Does
+  // nothing if the layout of {vector} differs from the profiled one.
+  void ApplyFeedback(Isolate* isolate, Tagged<FeedbackVector> vector);
+
+  size_t function_count() const { return functions_.size(); }
+
+ private:
+  struct SlotFeedback {
+    uint32_t slot;
+    FeedbackSlotKind kind;
+    // Accumulated feedback bits, call count or IcCheckType of a megamorphic
+    // property access, depending on {kind}.
+    uint32_t value;
+  };
+
+  struct FunctionProfile {
+    uint32_t slot_count = 0;
+    uint32_t invocation_count = 0;
+    CachedTieringDecision tiering_decision = CachedTieringDecision::kPending;
+    std::vector<SlotFeedback> slots;
+  };
+
+  // Checksum of the script source and start position of the function.
+  using Key = std::pair<uint32_t, int>;
+
+  FeedbackProfile() = default;
+
+  const FunctionProfile* Lookup(Tagged<SharedFunctionInfo> shared);
+
+  std::map<Key, FunctionProfile> functions_;
+  // Source checksums by script id, so that every script is hashed only once.
+  std::unordered_map<int, uint32_t> source_checksums_;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_EXECUTION_FEEDBACK_PROFILE_H_
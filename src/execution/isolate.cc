@@ -56,6 +56,7 @@
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/compilation-statistics.h"
+#include "src/execution/feedback-profile.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/local-isolate.h"
@@ -4858,7 +4859,11 @@ Isolate::Isolate(IsolateGroup* isolate_group)
   InitializeLoggingAndCounters();
   debug_ = new Debug(this);
 
-  InitializeDefaultEmbeddedBlob();
+  {
+    StartupTimeline::Scope timeline_scope(
+        this, StartupTimeline::Phase::kEmbeddedBlobSetup);
+    InitializeDefaultEmbeddedBlob();
+  }
 
 #if V8_ENABLE_WEBASSEMBLY
   // If we are in production V8 and not in mksnapshot we have to pass the
@@ -6313,6 +6318,8 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     // Must be done before deserializing RO space, since RO space may contain
     // builtin Code objects which point into the (potentially remapped)
     // embedded blob.
+    StartupTimeline::Scope timeline_scope(
+        this, StartupTimeline::Phase::kEmbeddedBlobSetup);
     MaybeRemapEmbeddedBuiltinsIntoCodeRange();
   }
   {
@@ -6349,8 +6356,12 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
     // However, we can't move SetIsolateThreadLocals here because the marking
     // barrier isn't setup yet.
     SetCurrentLocalHeapScope local_heap_scope(this);
-    isolate_group()->SetupReadOnlyHeap(this, read_only_snapshot_data,
-                                       can_rehash);
+    {
+      StartupTimeline::Scope timeline_scope(
+          this, StartupTimeline::Phase::kReadOnlyHeapSetup);
+      isolate_group()->SetupReadOnlyHeap(this, read_only_snapshot_data,
+                                         can_rehash);
+    }
     heap_.SetUpSpaces();
   }
 
@@ -6547,6 +6558,8 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   if (!create_heap_objects) {
     // If we are deserializing, read the state into the now-empty heap.
+    StartupTimeline::Scope timeline_scope(
+        this, StartupTimeline::Phase::kStartupDeserialization);
     SharedHeapDeserializer shared_heap_deserializer(
         this, shared_heap_snapshot_data, can_rehash);
     shared_heap_deserializer.DeserializeIntoIsolate();
@@ -6986,6 +6999,10 @@ void Isolate::MaybeInitializeVectorListFromHeap() {
   SetFeedbackVectorsForProfilingTools(*list);
 }
 
+void Isolate::set_feedback_profile(std::unique_ptr<FeedbackProfile> profile) {
+  feedback_profile_ = std::move(profile);
+}
+
 void Isolate::set_date_cache(DateCache* date_cache) {
   if (date_cache != date_cache_) {
     delete date_cache_;
@@ -44,6 +44,7 @@
 #include "src/heap/heap.h"
 #include "src/heap/read-only-heap.h"
 #include "src/init/isolate-group.h"
+#include "src/init/startup-timeline.h"
 #include "src/objects/code.h"
 #include "src/objects/contexts.h"
 #include "src/objects/debug-objects.h"
@@ -139,6 +140,7 @@ class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
 class EternalHandles;
+class FeedbackProfile;
 class GlobalHandles;
 class GlobalSafepoint;
 class HandleScopeImplementer;
@@ -489,6 +491,8 @@ V8_EXPORT_PRIVATE void FreeCurrentEmbeddedBlob();
   V(int, bad_char_shift_table, kUC16AlphabetSize)                              \
   V(int, good_suffix_shift_table, (kBMMaxShift + 1))                           \
   V(int, suffix_table, (kBMMaxShift + 1))                                      \
+  /* Code cache rejections, indexed by SerializedCodeSanityCheckResult. */     \
+  V(size_t, code_cache_reject_counts, kCodeCacheRejectReasonCount)             \
   ISOLATE_INIT_DEBUG_ARRAY_LIST(V)
 
 using DebugObjectCache = std::vector<Handle<HeapObject>>;
@@ -528,6 +532,8 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(int, code_and_metadata_size, 0)                                         \
   V(int, bytecode_and_metadata_size, 0)                                     \
   V(int, external_script_source_size, 0)                                    \
+  V(size_t, code_cache_accepted_count, 0)                                   \
+  V(size_t, code_cache_accepted_with_flags_mismatch_count, 0)               \
   /* Number of CPU profilers running on the isolate. */                     \
   V(size_t, num_cpu_profilers, 0)                                           \
   /* true if a trace is being formatted through Error.prepareStackTrace. */ \
@@ -1594,6 +1600,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   }
 
   static const int kJSRegexpStaticOffsetsVectorSize = 128;
+  // Number of SerializedCodeSanityCheckResult values.
+  static const int kCodeCacheRejectReasonCount = 10;
 
   THREAD_LOCAL_TOP_ACCESSOR(ExternalCallbackScope*, external_callback_scope)
 
@@ -1677,6 +1685,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return heap_.MonotonicallyIncreasingTimeInMs() - time_millis_at_init_;
   }
 
+  StartupTimeline* startup_timeline() { return &startup_timeline_; }
+
   DateCache* date_cache() const { return date_cache_; }
 
   void set_date_cache(DateCache* date_cache);
@@ -2067,6 +2077,11 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return lazy_compile_dispatcher_.get();
   }
 
+  // Feedback carried over from a previous process, see
+  // v8::Isolate::LoadFeedbackProfile.
+  FeedbackProfile* feedback_profile() const { return feedback_profile_.get(); }
+  void set_feedback_profile(std::unique_ptr<FeedbackProfile> profile);
+
   bool IsInCreationContext(Tagged<JSObject> object, uint32_t index);
 
   void ClearKeptObjects();
@@ -2792,6 +2807,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // Time stamp at initialization.
   double time_millis_at_init_ = 0;
 
+  // Phases of creating this isolate and its contexts, see
+  // v8::Isolate::GetStartupStatistics.
+  StartupTimeline startup_timeline_;
+
 #ifdef DEBUG
   static std::atomic<size_t> non_disposed_isolates_;
 
@@ -2813,6 +2832,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Zone* compiler_zone_ = nullptr;
 
   std::unique_ptr<LazyCompileDispatcher> lazy_compile_dispatcher_;
+  std::unique_ptr<FeedbackProfile> feedback_profile_;
 #ifdef V8_ENABLE_SPARKPLUG
   baseline::BaselineBatchCompiler* baseline_batch_compiler_ = nullptr;
 #endif  // V8_ENABLE_SPARKPLUG
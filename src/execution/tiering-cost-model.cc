@@ -0,0 +1,144 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/execution/tiering-cost-model.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "src/flags/flags.h"
+#include "src/objects/code-kind.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Rough speedups of code for monomorphic feedback over the tier below.
+constexpr double kMaglevSpeedup = 4.0;
+constexpr double kTurbofanSpeedup = 2.0;
+
+// Feedback quality of the typical function the default budgets are tuned for.
+constexpr double kReferenceQuality = 0.75;
+
+// Compile time grows faster than the bytecode size for large functions, most
+// notably in Turbofan because of inlining. Beyond this size, every doubling
+// of the bytecode adds a quarter to the budget.
+constexpr int kLargeFunctionBytecodeLength = 1024;
+
+// Feedback of these kinds says nothing about the types seen at runtime.
+bool IsTypeFeedbackKind(FeedbackSlotKind kind) {
+  return kind != FeedbackSlotKind::kLiteral &&
+         kind != FeedbackSlotKind::kJumpLoop &&
+         kind != FeedbackSlotKind::kInvalid;
+}
+
+// The fraction of the time spent in the function that the next tier saves.
+double Benefit(double speedup, double quality) {
+  return 1.0 - 1.0 / std::max(1.0, speedup * quality);
+}
+
+}  // namespace
+
+double TieringCostModel::FeedbackSummary::Quality() const {
+  double quality = 1.0;
+  if (slots > 0) {
+    quality -= (0.25 * uninitialized + 0.5 * polymorphic + 0.75 * megamorphic) /
+               slots;
+  }
+  if (unstable) quality *= 0.8;
+  return std::max(quality, 0.1);
+}
+
+// static
+TieringCostModel::FeedbackSummary TieringCostModel::Summarize(
+    Isolate* isolate, Tagged<FeedbackVector> vector) {
+  DCHECK(v8_flags.tiering_cost_model);
+  DisallowGarbageCollection no_gc;
+  FeedbackSummary summary;
+  summary.unstable = vector->interrupt_budget_reset_by_ic_change() ||
+                     vector->was_once_deoptimized();
+  FeedbackMetadataIterator iter(vector->metadata(), no_gc);
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+    if (!IsTypeFeedbackKind(iter.kind())) continue;
+    FeedbackNexus nexus(isolate, vector, slot);
+    summary.slots++;
+    switch (nexus.ic_state()) {
+      case InlineCacheState::NO_FEEDBACK:
+      case InlineCacheState::UNINITIALIZED:
+        summary.uninitialized++;
+        break;
+      case InlineCacheState::MONOMORPHIC:
+      case InlineCacheState::HOMOMORPHIC:
+      case InlineCacheState::MEGADOM:
+        summary.monomorphic++;
+        break;
+      case InlineCacheState::RECOMPUTE_HANDLER:
+      case InlineCacheState::POLYMORPHIC:
+        summary.polymorphic++;
+        break;
+      case InlineCacheState::MEGAMORPHIC:
+      case InlineCacheState::GENERIC:
+        summary.megamorphic++;
+        break;
+    }
+  }
+  return summary;
+}
+
+// static
+double TieringCostModel::BudgetScale(Isolate* isolate,
+                                     Tagged<FeedbackVector> vector,
+                                     CodeKind target, int bytecode_length) {
+  if (!v8_flags.tiering_cost_model) return 1.0;
+  DCHECK(CodeKindIsOptimizedJSFunction(target));
+  const double speedup =
+      target == CodeKind::MAGLEV ? kMaglevSpeedup : kTurbofanSpeedup;
+  const double reference_benefit = Benefit(speedup, kReferenceQuality);
+  const double min_scale = v8_flags.tiering_cost_model_min_scale;
+  const double max_scale =
+      std::max(min_scale, double{v8_flags.tiering_cost_model_max_scale});
+
+  // The budget to break even is proportional to compile cost over benefit.
+  const double benefit =
+      std::max(Benefit(speedup, Summarize(isolate, vector).Quality()),
+               reference_benefit / max_scale);
+  double scale = reference_benefit / benefit;
+  if (target == CodeKind::TURBOFAN_JS &&
+      bytecode_length > kLargeFunctionBytecodeLength) {
+    scale *= 1.0 + 0.25 * std::log2(static_cast<double>(bytecode_length) /
+                                    kLargeFunctionBytecodeLength);
+  }
+  return std::clamp(scale, min_scale, max_scale);
+}
+
+// static
+int TieringCostModel::ScaleBudget(Isolate* isolate,
+                                  Tagged<FeedbackVector> vector,
+                                  CodeKind target, int bytecode_length,
+                                  int budget) {
+  if (!v8_flags.tiering_cost_model) return budget;
+  const double scale = BudgetScale(isolate, vector, target, bytecode_length);
+  const int scaled_budget = static_cast<int>(
+      std::min(budget * scale, static_cast<double>(INT_MAX / 2)));
+  if (V8_UNLIKELY(v8_flags.trace_tiering_cost_model)) {
+    FeedbackSummary summary = Summarize(isolate, vector);
+    PrintF(
+        "[tiering cost model: %s to %s, %d bytecodes, %d feedback slots (%d "
+        "uninitialized, %d polymorphic, %d megamorphic%s), quality %.2f, "
+        "budget %d scaled by %.2f to %d]\n",
+        vector->shared_function_info()->DebugNameCStr().get(),
+        CodeKindToString(target), bytecode_length, summary.slots,
+        summary.uninitialized, summary.polymorphic, summary.megamorphic,
+        summary.unstable ? ", unstable" : "", summary.Quality(), budget, scale,
+        scaled_budget);
+  }
+  return scaled_budget;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,66 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_EXECUTION_TIERING_COST_MODEL_H_
+#define V8_EXECUTION_TIERING_COST_MODEL_H_
+
+#include "src/common/globals.h"
+#include "src/objects/tagged.h"
+
+namespace v8 {
+namespace internal {
+
+class FeedbackVector;
+class Isolate;
+enum class CodeKind : uint8_t;
+
+// Estimates how much a function gains from tiering up, so that the interrupt
+// budget to reach the next tier can be adjusted per function (see
+// --tiering-cost-model).
+//
+// The interrupt budget is already measured in executed bytecode, so every
+// interrupt tick is a sample of the time spent in the function. The default
+// budgets (e.g. --invocation-count-for-maglev) are treated as the break-even
+// point of a function with typical feedback: compiling costs time
+// proportional to the bytecode size, and the budget is the work that has to
+// be observed before the expected speedup pays for it. Functions with stable,
+// monomorphic feedback gain more from the next tier and tier up sooner;
+// functions whose feedback is polymorphic, megamorphic, mostly uninitialized
+// or still changing gain less and are held back.
+class TieringCostModel final {
+ public:
+  struct FeedbackSummary {
+    int slots = 0;
+    int uninitialized = 0;
+    int monomorphic = 0;
+    int polymorphic = 0;
+    int megamorphic = 0;
+    // Whether an IC changed after the function became hot, or code
+    // specialized on the feedback was deoptimized.
+    bool unstable = false;
+
+    // 1 for perfectly monomorphic and stable feedback, smaller the less
+    // specialized code for the feedback would be.
+    double Quality() const;
+  };
+
+  static FeedbackSummary Summarize(Isolate* isolate,
+                                   Tagged<FeedbackVector> vector);
+
+  // Returns the factor by which the default interrupt budget for tiering up
+  // the function owning {vector} to {target} should be scaled. Always 1 if
+  // --tiering-cost-model is off.
+  static double BudgetScale(Isolate* isolate, Tagged<FeedbackVector> vector,
+                            CodeKind target, int bytecode_length);
+
+  // Applies BudgetScale to {budget}, saturating below INT_MAX / 2 so that
+  // forward jumps cannot overflow the budget.
+  static int ScaleBudget(Isolate* isolate, Tagged<FeedbackVector> vector,
+                         CodeKind target, int bytecode_length, int budget);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_EXECUTION_TIERING_COST_MODEL_H_
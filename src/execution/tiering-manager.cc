@@ -16,6 +16,7 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/tiering-cost-model.h"
 #include "src/flags/flags.h"
 #include "src/handles/global-handles.h"
 #include "src/init/bootstrapper.h"
@@ -177,6 +178,14 @@ bool TiersUpToMaglev(std::optional<CodeKind> code_kind) {
   return code_kind.has_value() && TiersUpToMaglev(code_kind.value());
 }
 
+// Only looks at the feedback vector with --tiering-cost-model.
+int ScaledBudgetFor(Isolate* isolate, Tagged<JSFunction> function,
+                    CodeKind target, int bytecode_length, int budget) {
+  if (!v8_flags.tiering_cost_model) return budget;
+  return TieringCostModel::ScaleBudget(isolate, function->feedback_vector(),
+                                       target, bytecode_length, budget);
+}
+
 int InterruptBudgetFor(Isolate* isolate, std::optional<CodeKind> code_kind,
                        Tagged<JSFunction> function,
                        CachedTieringDecision cached_tiering_decision,
@@ -227,16 +236,22 @@ int InterruptBudgetFor(Isolate* isolate, std::optional<CodeKind> code_kind,
         case CachedTieringDecision::kPending:
         case CachedTieringDecision::kEarlySparkplug:
         case CachedTieringDecision::kNormal:
-          return v8_flags.invocation_count_for_maglev * bytecode_length;
+          return ScaledBudgetFor(
+              isolate, function, CodeKind::MAGLEV, bytecode_length,
+              v8_flags.invocation_count_for_maglev * bytecode_length);
       }
       // The enum value is coming from inside the sandbox and while the switch
       // is exhaustive, it's not guaranteed that value is one of the declared
       // values.
       UNREACHABLE();
     }
-    return v8_flags.invocation_count_for_maglev * bytecode_length;
+    return ScaledBudgetFor(
+        isolate, function, CodeKind::MAGLEV, bytecode_length,
+        v8_flags.invocation_count_for_maglev * bytecode_length);
   }
-  return v8_flags.invocation_count_for_turbofan * bytecode_length;
+  return ScaledBudgetFor(
+      isolate, function, CodeKind::TURBOFAN_JS, bytecode_length,
+      v8_flags.invocation_count_for_turbofan * bytecode_length);
 }
 
 }  // namespace
@@ -492,15 +507,25 @@ void TieringManager::NotifyICChanged(Tagged<FeedbackVector> vector) {
     Tagged<FeedbackCell> cell = vector->parent_feedback_cell();
     int invocations = v8_flags.minimum_invocations_after_ic_update;
     int bytecodes = std::min(bytecode_length, (kMaxInt >> 1) / invocations);
-    int new_budget = invocations * bytecodes;
+    // With --tiering-cost-model, functions whose feedback keeps changing are
+    // held back longer than functions that just saw their first IC update.
+    int new_budget = TieringCostModel::ScaleBudget(
+        isolate_, vector, decision.code_kind, bytecode_length,
+        invocations * bytecodes);
     int current_budget = cell->interrupt_budget();
     if (v8_flags.profile_guided_optimization &&
         shared->cached_tiering_decision() <=
             CachedTieringDecision::kEarlySparkplug) {
       DCHECK_LT(v8_flags.invocation_count_for_early_optimization,
                 FeedbackVector::kInvocationCountBeforeStableDeoptSentinel);
-      if (vector->invocation_count_before_stable() <
-          v8_flags.invocation_count_for_early_optimization) {
+      if (V8_UNLIKELY(v8_flags.tiering_cost_model)) {
+        // The installed budgets were scaled by the feedback at the time they
+        // were set, so the consumed budget doesn't tell how many invocations
+        // happened before the IC change. The cost model decides how early to
+        // tier up instead.
+        shared->set_cached_tiering_decision(CachedTieringDecision::kNormal);
+      } else if (vector->invocation_count_before_stable() <
+                 v8_flags.invocation_count_for_early_optimization) {
         // Record how many invocation count were consumed before the last IC
         // change.
         int new_invocation_count_before_stable;
@@ -582,10 +582,14 @@ DEFINE_BOOL(maglev_truncation, true, "Enable Maglev truncation pass")
 DEFINE_DEVELOPER_FLAG(trace_maglev_truncation, "trace maglev truncation pass")
 
 DEFINE_EXPERIMENTAL_FEATURE(maglev_licm, "loop invariant code motion")
+DEFINE_EXPERIMENTAL_FEATURE(maglev_bounds_check_elimination,
+                            "range based bounds check elimination in loops")
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_speculative_hoist_phi_untagging)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_api_calls)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_escape_analysis)
 DEFINE_WEAK_IMPLICATION(maglev_future, maglev_licm)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_bounds_check_elimination)
+DEFINE_WEAK_IMPLICATION(maglev_future, maglev_inline_closure_allocation)
 
 DEFINE_BOOL(turbolev_truncated_int32_phis, true,
             "Enable truncated to int32 representation in the phi selector")
@@ -978,6 +982,13 @@ DEFINE_NEG_NEG_IMPLICATION(allocation_site_tracking,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(allocation_site_lifetime_histogram, false,
+            "base pretenuring decisions on a decaying histogram of survival "
+            "ratios over several young generation GCs instead of on the last "
+            "GC only")
+DEFINE_FLOAT(allocation_site_lifetime_decay, 0.75,
+             "weight of the existing lifetime histogram of an allocation site "
+             "when a new survival ratio is recorded")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation "
@@ -1071,6 +1082,17 @@ DEFINE_INT(minimum_invocations_after_ic_update, 500,
 DEFINE_INT(minimum_invocations_before_optimization, 2,
            "Minimum number of invocations we need before non-OSR optimization")
 
+// Tiering: cost model.
+DEFINE_BOOL(tiering_cost_model, false,
+            "scale the interrupt budget for tiering up by the expected benefit "
+            "of the next tier, estimated from feedback stability and size")
+DEFINE_FLOAT(tiering_cost_model_min_scale, 0.5,
+             "lower bound of the interrupt budget scale of the cost model")
+DEFINE_FLOAT(tiering_cost_model_max_scale, 4.0,
+             "upper bound of the interrupt budget scale of the cost model")
+DEFINE_BOOL(trace_tiering_cost_model, false,
+            "trace the interrupt budgets chosen by the tiering cost model")
+
 // Tiering: JIT fuzzing.
 //
 // When --jit-fuzzing is enabled, various tiering related thresholds are
@@ -1533,6 +1555,9 @@ DEFINE_EXPERIMENTAL_FEATURE(maglev_object_tracking,
                             "track object changes to avoid escaping them")
 DEFINE_DEVELOPER_FLAG(trace_maglev_object_tracking,
                       "trace load/stores from maglev virtual objects")
+DEFINE_EXPERIMENTAL_FEATURE(
+    maglev_inline_closure_allocation,
+    "allocate closures inline, so that escape analysis can elide them")
 DEFINE_WEAK_IMPLICATION(trace_maglev_graph_building,
                         trace_maglev_object_tracking)
 DEFINE_WEAK_IMPLICATION(trace_maglev_graph_building, maglev_print_bytecode)
@@ -1694,6 +1719,9 @@ DEFINE_BOOL(turboshaft_loop_unrolling, true,
             "enable Turboshaft's loop unrolling")
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_loop_optimization,
                             "enable Turboshaft's loop optimization phase")
+DEFINE_EXPERIMENTAL_FEATURE(
+    turboshaft_loop_vectorization,
+    "enable Turboshaft's loop vectorization of typed array loops")
 DEFINE_EXPERIMENTAL_FEATURE(turboshaft_random_rescheduling,
                             "enable Turboshaft's random rescheduling phase")
 DEFINE_BOOL(turboshaft_string_concat_escape_analysis, true,
@@ -1799,6 +1827,8 @@ DEFINE_DEVELOPER_FLAG(turboshaft_trace_unrolling,
                       "trace Turboshaft's loop unrolling reducer")
 DEFINE_DEVELOPER_FLAG(turboshaft_trace_peeling,
                       "trace Turboshaft's loop peeling reducer")
+DEFINE_DEVELOPER_FLAG(turboshaft_trace_vectorization,
+                      "trace Turboshaft's loop vectorization reducer")
 DEFINE_DEVELOPER_FLAG(turboshaft_trace_load_elimination,
                       "trace Turboshaft's late load elimination")
 DEFINE_DEVELOPER_FLAG(turboshaft_trace_store_store_elimination,
@@ -2517,6 +2547,10 @@ DEFINE_INT(dispatch_table_gc_interval, -1,
 
 DEFINE_SMI(retain_maps_for_n_gc, 2,
            "keeps maps alive for <n> old space garbage collections")
+DEFINE_BOOL(shape_compaction, false,
+            "do not retain deprecated maps, such that full garbage collections "
+            "drop them together with their transitions once no instance uses "
+            "them")
 DEFINE_DEVELOPER_FLAG(trace_gc,
                       "print one trace line following each garbage collection")
 DEFINE_DEVELOPER_FLAG(trace_gc_nvp,
@@ -2574,6 +2608,12 @@ DEFINE_BOOL(incremental_marking_unified_schedule, false,
             "JS and C++ objects.")
 DEFINE_DEVELOPER_FLAG(trace_unmapper, "Trace the unmapping")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_INT(scavenger_max_tasks, 8,
+           "maximum number of parallel scavenge tasks including the main "
+           "thread")
+DEFINE_BOOL(scavenger_split_large_arrays, false,
+            "split the bodies of large fixed arrays into slices that can be "
+            "processed by parallel scavenge tasks")
 DEFINE_BOOL(minor_gc_task, true, "schedule minor GC tasks")
 DEFINE_UINT(minor_gc_task_trigger, 80,
             "minor GC task trigger in percent of the current heap limit")
@@ -2611,6 +2651,9 @@ DEFINE_DEVELOPER_FLAG(trace_concurrent_marking, "trace concurrent marking")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_NEG_NEG_IMPLICATION(concurrent_sweeping,
                            concurrent_array_buffer_sweeping)
+DEFINE_BOOL(concurrent_large_page_release, true,
+            "release dead large pages from the sweeper instead of unmapping "
+            "them on the main thread at the end of full GCs")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
@@ -2711,6 +2754,20 @@ DEFINE_REQUIREMENT(v8_flags.memory_reducer_delay_ms > 0)
 DEFINE_INT(gc_memory_reducer_start_delay_ms, 30'000,
            "Delay before memory reducer start")
 DEFINE_REQUIREMENT(v8_flags.gc_memory_reducer_start_delay_ms > 0)
+DEFINE_BOOL(container_memory_awareness, false,
+            "size the heap by the cgroup v2 memory limit and reduce memory "
+            "when the container runs out of memory or stalls on memory")
+DEFINE_UINT(container_heap_limit_percent, 75,
+            "maximum old generation size in percent of the container memory "
+            "limit")
+DEFINE_UINT(container_memory_pressure_percent, 90,
+            "container memory usage in percent of its limit above which "
+            "memory-reducing GCs are triggered")
+DEFINE_FLOAT(container_memory_stall_percent, 10.0,
+             "memory pressure stall time (PSI some avg10) in percent above "
+             "which memory-reducing GCs are triggered")
+DEFINE_INT(container_memory_sampling_interval_ms, 1'000,
+           "minimum interval between two samples of container memory")
 DEFINE_FLOAT(
     external_memory_max_growing_factor, 1.1,
     "This is the upper bound for growing factor imposed on external memory.")
@@ -2763,6 +2820,19 @@ DEFINE_INT(compaction_target_fragmentation_percent_for_reduce_memory, 20,
 DEFINE_INT(compaction_target_fragmentation_percent_for_optimize_memory, 20,
            "Target fragmentation % during compaction for GCs when "
            "ShouldOptimizeForMemoryUsage() = true")
+DEFINE_BOOL(adaptive_evacuation_candidates_selection, false,
+            "Select evacuation candidates by the ratio of reclaimable "
+            "fragmented free list memory to evacuation cost instead of by "
+            "live bytes")
+DEFINE_MAYBE_BOOL(
+    incremental_compaction,
+    "Forces incremental compaction on or off, disregarding the per-isolate "
+    "setting. Incremental compaction bounds the bytes evacuated in a single "
+    "atomic pause and spreads compaction of fragmented pages over several "
+    "full GCs.")
+DEFINE_FLOAT(incremental_compaction_pause_budget_ms, 1.0,
+             "Time budget for evacuating old generation pages in a single "
+             "atomic pause when incremental compaction is enabled")
 DEFINE_BOOL(shortcut_strings_with_stack, true,
             "Shortcut Strings during GC with stack")
 DEFINE_BOOL(stress_compaction, false,
@@ -2812,6 +2882,10 @@ DEFINE_BOOL(
 DEFINE_BOOL(memory_pool_release_on_malloc_failures, false,
             "discard the memory pool on malloc retries")
 DEFINE_SIZE_T(memory_pool_timeout, 8, "Release pooled pages after X seconds.")
+DEFINE_SIZE_T(memory_pool_max_prefaulted_pages, 0,
+              "Maximum number of pooled pages per isolate that a background "
+              "task keeps pre-faulted ahead of allocation after young "
+              "generation GCs (0 disables pre-faulting).")
 DEFINE_BOOL(large_page_pool, true, "Add large pages to the page pool")
 DEFINE_SIZE_T(max_large_page_pool_size, 32,
               "Maximum size of pooled large pages in MB.")
@@ -2822,6 +2896,16 @@ DEFINE_BOOL(managed_zone_memory_for_isolate_independent_memory, false,
             "(e.g. Wasm).")
 DEFINE_WEAK_IMPLICATION(future, managed_zone_memory)
 DEFINE_NEG_NEG_IMPLICATION(memory_pool, managed_zone_memory)
+DEFINE_BOOL(huge_pages, false,
+            "Back the heap, code space and the pointer compression cage with "
+            "transparent huge pages where supported by the OS")
+DEFINE_UINT(huge_pages_max_collapses_per_gc, 8,
+            "Maximum number of fully used huge page regions that are "
+            "collapsed after a full GC")
+DEFINE_BOOL(share_read_only_pages_across_isolate_groups, false,
+            "Back identical read-only space pages of isolate groups created "
+            "from the same snapshot with the same physical memory (Linux "
+            "only)")
 
 DEFINE_BOOL(fuzzer_gc_analysis, false,
             "prints number of allocations and enables analysis mode for gc "
@@ -3375,6 +3459,9 @@ DEFINE_BOOL(correctness_fuzzer_suppressions, false,
             "Use a fixed suppression string for error messages.")
 DEFINE_BOOL(rehash_snapshot, false,
             "rehash strings from the snapshot to override the baked-in seed")
+DEFINE_BOOL(parallel_snapshot_string_hashing, true,
+            "compute the hashes of deserialized strings on worker threads when "
+            "rehashing the snapshot")
 DEFINE_UINT64(hash_seed, 0,
               "Fixed seed to use to hash property keys (0 means random)"
               "(with snapshots this option cannot override the baked-in seed)")
@@ -3439,8 +3526,25 @@ DEFINE_BOOL(verify_snapshot_checksum, DEBUG_BOOL,
             "Verify snapshot checksums when deserializing snapshots. Enable "
             "checksum creation and verification for code caches. Enabled by "
             "default in debug builds and once per process for Android.")
+DEFINE_BOOL(code_cache_relaxed_flag_check, true,
+            "Accept code caches produced with different flags as long as the "
+            "flags that can affect the cached data match.")
 DEFINE_DEVELOPER_FLAG(profile_deserialization,
                       "Print the time it takes to deserialize the snapshot.")
+DEFINE_BOOL(map_snapshot_blob, true,
+            "Map the external startup snapshot blob read-only instead of "
+            "copying it into the heap, so that processes using the same blob "
+            "share its pages.")
+DEFINE_STRING(snapshot_compression_codec, "zlib",
+              "Codec used to compress snapshots in builds with snapshot "
+              "compression (zlib, lz). Both codecs can be decompressed.")
+DEFINE_BOOL(parallel_snapshot_decompression, true,
+            "decompress the blocks of lz-compressed snapshots on worker "
+            "threads")
+DEFINE_BOOL(snapshot_discard_unexecuted_code, false,
+            "When creating a snapshot that keeps function code, discard the "
+            "bytecode of functions that never ran. They are compiled lazily "
+            "on first call instead of being deserialized at startup.")
 DEFINE_DEVELOPER_FLAG(trace_deserialization,
                       "Trace the snapshot deserialization.")
 DEFINE_DEVELOPER_FLAG(serialization_statistics,
@@ -4239,6 +4343,8 @@ DEFINE_NEG_IMPLICATION(single_threaded, lazy_compile_dispatcher)
 DEFINE_NEG_IMPLICATION(single_threaded,
                        parallel_compile_tasks_for_eager_toplevel)
 DEFINE_NEG_IMPLICATION(single_threaded, parallel_compile_tasks_for_lazy)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_string_hashing)
+DEFINE_NEG_IMPLICATION(single_threaded, parallel_snapshot_decompression)
 #ifdef V8_ENABLE_MAGLEV
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_deopt_data_on_background)
 DEFINE_NEG_IMPLICATION(single_threaded, maglev_build_code_on_background)
@@ -587,9 +587,23 @@ std::ostream& operator<<(std::ostream& os, const Flag& flag) {
 }
 
 static std::atomic<uint32_t> flag_hash{0};
+static std::atomic<uint32_t> code_cache_flag_hash{0};
 static std::atomic<bool> flags_frozen{false};
 
-uint32_t ComputeFlagListHash() {
+// Flags that only affect tracing, logging, printing or the optimizing tiers.
+// None of them can change the bytecode, scope infos or feedback metadata that
+// end up in a code cache.
+static bool IsIrrelevantForCodeCache(const Flag& flag) {
+  static constexpr const char* kPrefixes[] = {"trace_", "print_", "log_",
+                                              "turbo", "maglev"};
+  std::string_view name(flag.name());
+  for (const char* prefix : kPrefixes) {
+    if (name.starts_with(prefix)) return true;
+  }
+  return false;
+}
+
+uint32_t ComputeFlagListHash(bool for_code_cache = false) {
   std::ostringstream modified_args_as_string;
   if (COMPRESS_POINTERS_BOOL) modified_args_as_string << "ptr-compr";
   if (DEBUG_BOOL) modified_args_as_string << "debug";
@@ -606,6 +620,7 @@ uint32_t ComputeFlagListHash() {
 
   for (const Flag& flag : flags) {
     if (flag.IsDefault()) continue;
+    if (for_code_cache && IsIrrelevantForCodeCache(flag)) continue;
 #ifdef DEBUG
     if (flag.ImpliedBy(&v8_flags.predictable) &&
         // Ignore --random-seed, which is implied by predictable but also just
@@ -993,6 +1008,7 @@ bool FlagList::IsFrozen() {
 // static
 void FlagList::ReleaseDynamicAllocations() {
   flag_hash = 0;
+  code_cache_flag_hash = 0;
   for (size_t i = 0; i < kNumFlags; ++i) {
     flags[i].ReleaseDynamicAllocations();
   }
@@ -1551,12 +1567,23 @@ uint32_t FlagList::Hash() {
   return hash;
 }
 
+// static
+uint32_t FlagList::CodeCacheHash() {
+  if (uint32_t hash = code_cache_flag_hash.load(std::memory_order_relaxed)) {
+    return hash;
+  }
+  uint32_t hash = ComputeFlagListHash(true);
+  code_cache_flag_hash.store(hash, std::memory_order_relaxed);
+  return hash;
+}
+
 // static
 void FlagList::ResetFlagHash() {
   // If flags are frozen, we should not need to reset the hash since we cannot
   // change flag values anyway.
   CHECK(!IsFrozen());
   flag_hash = 0;
+  code_cache_flag_hash = 0;
 }
 
 }  // namespace v8::internal
@@ -168,6 +168,10 @@ class V8_EXPORT_PRIVATE FlagList {
   // This hash is calculated during V8::Initialize and cached.
   static uint32_t Hash();
 
+  // Like Hash(), but ignores flags that cannot change the contents of code
+  // caches, e.g. tracing flags.
+  static uint32_t CodeCacheHash();
+
  private:
   // Reset the flag hash on flag changes. This is a private method called from
   // {FlagValue<T>::operator=}; there should be no need to call it from any
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_BASE_WORKLIST_H_
 #define V8_HEAP_BASE_WORKLIST_H_
 
+#include <algorithm>
 #include <cstddef>
 #include <utility>
 
@@ -331,6 +332,12 @@ class Worklist<EntryType, MinSegmentSize>::Local final {
 
   void Publish();
 
+  // Makes local work available for stealing by other local views if the
+  // global worklist is empty. Publishes the push segment if it holds work and
+  // otherwise splits off half of the pop segment. Returns true if any work was
+  // published.
+  bool ShareWorkIfGlobalEmpty();
+
   void Merge(Worklist<EntryType, MinSegmentSize>::Local& other);
 
   void Clear();
@@ -438,6 +445,27 @@ void Worklist<EntryType, MinSegmentSize>::Local::Publish() {
   }
 }
 
+template <typename EntryType, uint16_t MinSegmentSize>
+bool Worklist<EntryType, MinSegmentSize>::Local::ShareWorkIfGlobalEmpty() {
+  if (!worklist_.IsEmpty()) return false;
+  if (!push_segment_->IsEmpty()) {
+    PublishPushSegment();
+    push_segment_ = internal::SegmentBase::GetSentinelSegmentAddress();
+    return true;
+  }
+  if (pop_segment_->Size() < 2) return false;
+  Segment* segment = NewSegment();
+  const size_t entries_to_share =
+      std::min(pop_segment_->Size() / 2, segment->Capacity());
+  for (size_t i = 0; i < entries_to_share; i++) {
+    EntryType entry;
+    pop_segment()->Pop(&entry);
+    segment->Push(entry);
+  }
+  worklist_.Push(segment);
+  return true;
+}
+
 template <typename EntryType, uint16_t MinSegmentSize>
 void Worklist<EntryType, MinSegmentSize>::Local::Merge(
     Worklist<EntryType, MinSegmentSize>::Local& other) {
@@ -183,6 +183,7 @@ bool CodeRange::InitReservation(v8::PageAllocator* page_allocator,
         base::PageInitializationMode::kRecommitOnly;
     params.page_freeing_mode = base::PageFreeingMode::kDiscard;
   }
+  params.use_huge_pages = v8_flags.huge_pages;
 
 #if defined(V8_TARGET_OS_IOS) || defined(V8_TARGET_OS_CHROMEOS)
   // iOS:
@@ -0,0 +1,65 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/container-memory-monitor.h"
+
+#include <algorithm>
+
+#include "src/flags/flags.h"
+
+namespace v8::internal {
+
+ContainerMemoryMonitor::ContainerMemoryMonitor(Provider provider)
+    : provider_(provider) {
+  DCHECK_NOT_NULL(provider_);
+}
+
+size_t ContainerMemoryMonitor::CapMaxOldGenerationSize(
+    size_t max_old_generation_size) const {
+  const base::OS::ContainerMemoryInfo info = provider_();
+  if (!info.limit) return max_old_generation_size;
+  const uint64_t container_limit =
+      *info.limit / 100 * v8_flags.container_heap_limit_percent;
+  return static_cast<size_t>(
+      std::min<uint64_t>(max_old_generation_size, container_limit));
+}
+
+MemoryPressureLevel ContainerMemoryMonitor::Sample(double now_ms) {
+  if (last_sample_ms_ &&
+      now_ms - *last_sample_ms_ <
+          v8_flags.container_memory_sampling_interval_ms) {
+    return MemoryPressureLevel::kNone;
+  }
+  last_sample_ms_ = now_ms;
+  const MemoryPressureLevel previous_level = last_level_;
+  last_level_ = ComputePressureLevel(provider_());
+  return last_level_ > previous_level ? last_level_
+                                      : MemoryPressureLevel::kNone;
+}
+
+// static
+MemoryPressureLevel ContainerMemoryMonitor::ComputePressureLevel(
+    const base::OS::ContainerMemoryInfo& info) {
+  if (info.limit && info.usage && *info.limit > 0) {
+    const double usage_percent =
+        100.0 * static_cast<double>(*info.usage) / *info.limit;
+    // Critical pressure starts half-way between the moderate threshold and the
+    // limit.
+    const double moderate_percent = v8_flags.container_memory_pressure_percent;
+    const double critical_percent = (moderate_percent + 100.0) / 2;
+    if (usage_percent >= critical_percent) {
+      return MemoryPressureLevel::kCritical;
+    }
+    if (usage_percent >= moderate_percent) {
+      return MemoryPressureLevel::kModerate;
+    }
+  }
+  if (info.stall_percent &&
+      *info.stall_percent >= v8_flags.container_memory_stall_percent) {
+    return MemoryPressureLevel::kModerate;
+  }
+  return MemoryPressureLevel::kNone;
+}
+
+}  // namespace v8::internal
@@ -0,0 +1,52 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONTAINER_MEMORY_MONITOR_H_
+#define V8_HEAP_CONTAINER_MEMORY_MONITOR_H_
+
+#include <optional>
+
+#include "include/v8-isolate.h"
+#include "src/base/platform/platform.h"
+#include "src/common/globals.h"
+
+namespace v8::internal {
+
+// Observes the memory limit and pressure of the container (cgroup v2) that the
+// process runs in (--container-memory-awareness). The heap uses the limit to
+// cap its maximum size and turns pressure into memory pressure notifications
+// which trigger memory-reducing GCs before the container limit is hit.
+class V8_EXPORT_PRIVATE ContainerMemoryMonitor final {
+ public:
+  using Provider = base::OS::ContainerMemoryInfo (*)();
+
+  explicit ContainerMemoryMonitor(
+      Provider provider = &base::OS::GetContainerMemoryInfo);
+
+  ContainerMemoryMonitor(const ContainerMemoryMonitor&) = delete;
+  ContainerMemoryMonitor& operator=(const ContainerMemoryMonitor&) = delete;
+
+  // Returns `max_old_generation_size` capped to --container-heap-limit-percent
+  // of the container memory limit.
+  size_t CapMaxOldGenerationSize(size_t max_old_generation_size) const;
+
+  // Samples container memory unless the last sample was taken less than
+  // --container-memory-sampling-interval-ms ago. Returns the new pressure level
+  // if it is higher than the one of the previous sample, and kNone otherwise,
+  // so that sustained pressure doesn't trigger a memory-reducing GC after
+  // every GC.
+  MemoryPressureLevel Sample(double now_ms);
+
+  static MemoryPressureLevel ComputePressureLevel(
+      const base::OS::ContainerMemoryInfo& info);
+
+ private:
+  const Provider provider_;
+  std::optional<double> last_sample_ms_;
+  MemoryPressureLevel last_level_ = MemoryPressureLevel::kNone;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_CONTAINER_MEMORY_MONITOR_H_
@@ -35,6 +35,12 @@ class MetricRecorder {
       int64_t after_bytes = -1;
       int64_t freed_bytes = -1;
     };
+    struct YoungGeneration {
+      int64_t remembered_slots = -1;
+      int64_t remembered_source_objects = -1;
+      // Fraction of the young generation that survived the cycle.
+      double survival_rate = -1;
+    };
 
     Type type = Type::kMajor;
     Phases total;
@@ -46,6 +52,8 @@ class MetricRecorder {
     double collection_rate_in_percent;
     double efficiency_in_bytes_per_us;
     double main_thread_efficiency_in_bytes_per_us;
+    // Only populated for minor GC cycles.
+    YoungGeneration young;
   };
 
   struct MainThreadIncrementalMark {
@@ -125,6 +125,14 @@ void StatsCollector::NotifyMarkingStarted(CollectionType collection_type,
   gc_state_ = GarbageCollectionState::kMarking;
 }
 
+void StatsCollector::NotifyRememberedSetVisited(size_t slots,
+                                                size_t source_objects) {
+  DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
+  DCHECK_EQ(CollectionType::kMinor, current_.collection_type);
+  current_.remembered_slots += slots;
+  current_.remembered_source_objects += source_objects;
+}
+
 void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
@@ -138,6 +146,10 @@ void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
 
   if (current_.collection_type == CollectionType::kMajor) {
     marked_bytes_so_far_ = 0;
+  } else {
+    // Objects that survived previous cycles are old and are not marked again.
+    current_.young_object_size_before_sweep_bytes =
+        current_.object_size_before_sweep_bytes - marked_bytes_so_far_;
   }
   marked_bytes_so_far_ += marked_bytes;
 
@@ -290,6 +302,16 @@ void StatsCollector::NotifySweepingCompleted(SweepingType sweeping_type) {
         previous_.memory_size_before_sweep_bytes -
             memory_freed_bytes_since_end_of_marking_ /* memory_after */,
         memory_freed_bytes_since_end_of_marking_ /* memory_freed */);
+    if (previous_.collection_type == CollectionType::kMinor) {
+      event.young.remembered_slots = previous_.remembered_slots;
+      event.young.remembered_source_objects =
+          previous_.remembered_source_objects;
+      event.young.survival_rate =
+          previous_.young_object_size_before_sweep_bytes == 0
+              ? 0
+              : static_cast<double>(previous_.marked_bytes) /
+                    previous_.young_object_size_before_sweep_bytes;
+    }
     metric_recorder_->AddMainThreadEvent(event);
   }
 }
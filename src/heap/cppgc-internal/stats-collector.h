@@ -129,6 +129,13 @@ class V8_EXPORT_PRIVATE StatsCollector final {
     size_t marked_bytes = 0;
     size_t object_size_before_sweep_bytes = -1;
     size_t memory_size_before_sweep_bytes = -1;
+    // Young generation only: Size of objects allocated since the previous
+    // cycle, i.e., the size of the young generation when marking finished.
+    size_t young_object_size_before_sweep_bytes = 0;
+    // Young generation only: Old-to-new slots and source objects that were
+    // visited from the remembered set.
+    size_t remembered_slots = 0;
+    size_t remembered_source_objects = 0;
   };
 
  private:
@@ -297,6 +304,9 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // Indicates a new minor garbage collection cycle or a major, if generational
   // GC is not enabled.
   void NotifyMarkingStarted(CollectionType, MarkingType, IsForcedGC);
+  // Indicates that the remembered set was visited as roots of a minor garbage
+  // collection cycle.
+  void NotifyRememberedSetVisited(size_t slots, size_t source_objects);
   // Indicates that marking of the current garbage collection cycle is
   // completed.
   void NotifyMarkingCompleted(size_t marked_bytes);
@@ -849,6 +849,11 @@ void GCTracer::AddCompactionEvent(double duration,
       live_bytes_compacted, base::TimeDelta::FromMillisecondsD(duration)));
 }
 
+void GCTracer::AddDeferredCompaction(size_t deferred_live_bytes) {
+  DCHECK(!Event::IsYoungGenerationEvent(current_.type));
+  current_.deferred_compaction_bytes += deferred_live_bytes;
+}
+
 void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
@@ -1166,6 +1171,9 @@ void GCTracer::PrintNVP() const {
              current_scope(Scope::MC_EVACUATE_UPDATE_POINTERS_SLOTS_MAIN))
           .p("evacuate.update_pointers.weak",
              current_scope(Scope::MC_EVACUATE_UPDATE_POINTERS_WEAK))
+          .p("evacuate.deferred_bytes", current_.deferred_compaction_bytes)
+          .p("evacuate.deferred_estimate",
+             EstimatedDeferredCompactionDuration().InMillisecondsF())
           .p("finish", current_scope(Scope::MC_FINISH))
           .p("finish.sweep_array_buffers",
              current_scope(Scope::MC_FINISH_SWEEP_ARRAY_BUFFERS))
@@ -1349,6 +1357,25 @@ std::optional<double> GCTracer::CompactionSpeedInBytesPerMillisecond() const {
   return BoundedAverageSpeed(recorded_compactions_);
 }
 
+std::optional<size_t> GCTracer::CompactionBytesForDuration(
+    base::TimeDelta duration) const {
+  const std::optional<double> compaction_speed =
+      CompactionSpeedInBytesPerMillisecond();
+  if (!compaction_speed.has_value()) return std::nullopt;
+  return static_cast<size_t>(*compaction_speed * duration.InMillisecondsF());
+}
+
+base::TimeDelta GCTracer::EstimatedDeferredCompactionDuration() const {
+  const std::optional<double> compaction_speed =
+      CompactionSpeedInBytesPerMillisecond();
+  if (!compaction_speed.has_value() ||
+      current_.deferred_compaction_bytes == 0) {
+    return base::TimeDelta();
+  }
+  return base::TimeDelta::FromMillisecondsD(
+      current_.deferred_compaction_bytes / *compaction_speed);
+}
+
 std::optional<double> GCTracer::MarkCompactSpeedInBytesPerMillisecond() const {
   return BoundedAverageSpeed(recorded_mark_compacts_);
 }
@@ -1930,6 +1957,10 @@ void GCTracer::ReportYoungCycleToRecorder() {
       DCHECK_NE(-1, cppgc_event.main_thread_efficiency_in_bytes_per_us);
       event.main_thread_efficiency_cpp_in_bytes_per_us =
           cppgc_event.main_thread_efficiency_in_bytes_per_us;
+      event.remembered_slots_cpp = cppgc_event.young.remembered_slots;
+      event.remembered_source_objects_cpp =
+          cppgc_event.young.remembered_source_objects;
+      event.survival_rate_cpp = cppgc_event.young.survival_rate;
     }
   }
 #endif  // defined(CPPGC_YOUNG_GENERATION)
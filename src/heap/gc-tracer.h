@@ -283,6 +283,10 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Number of JSGlobalProxy objects found during full GC.
     size_t found_js_global_proxies = 0;
 
+    // Live bytes on fragmented pages that were not selected as evacuation
+    // candidates because of the incremental compaction budget.
+    size_t deferred_compaction_bytes = 0;
+
     // Approximate number of threads that contributed in garbage collection.
     size_t concurrency_estimate = 1;
 
@@ -405,6 +409,10 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddCompactionEvent(double duration, size_t live_bytes_compacted);
 
+  // Records live bytes on fragmented pages whose evacuation was deferred to a
+  // later GC by incremental compaction.
+  void AddDeferredCompaction(size_t deferred_live_bytes);
+
   void AddSurvivalRatio(double survival_ratio);
 
   void SampleConcurrencyEsimate(size_t concurrency);
@@ -438,6 +446,16 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Returns nullopt if not enough events have been recorded.
   std::optional<double> CompactionSpeedInBytesPerMillisecond() const;
 
+  // Returns the live bytes that can be evacuated within `duration` based on
+  // the compaction speed. Returns nullopt if not enough events have been
+  // recorded.
+  std::optional<size_t> CompactionBytesForDuration(
+      base::TimeDelta duration) const;
+
+  // Estimated pause time that incremental compaction moved out of the
+  // evacuation phase of the current cycle, based on the compaction speed.
+  base::TimeDelta EstimatedDeferredCompactionDuration() const;
+
   // Compute the average mark-sweep speed in bytes/millisecond.
   // Returns nullopt if no events have been recorded.
   std::optional<double> MarkCompactSpeedInBytesPerMillisecond() const;
@@ -691,6 +709,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   FRIEND_TEST(GCTracerTest, BackgroundMinorMSScope);
   FRIEND_TEST(GCTracerTest, BackgroundMajorMCScope);
   FRIEND_TEST(GCTracerTest, CyclePriorities);
+  FRIEND_TEST(GCTracerTest, DeferredCompaction);
   FRIEND_TEST(GCTracerTest, EmbedderAllocationThroughput);
   FRIEND_TEST(GCTracerTest, MultithreadedBackgroundScope);
   FRIEND_TEST(GCTracerTest, NewSpaceAllocationThroughput);
@@ -7,6 +7,7 @@
 #include <algorithm>
 #include <atomic>
 #include <cinttypes>
+#include <cmath>
 #include <iomanip>
 #include <memory>
 #include <optional>
@@ -57,6 +58,7 @@
 #include "src/heap/collection-barrier.h"
 #include "src/heap/combined-heap.h"
 #include "src/heap/concurrent-marking.h"
+#include "src/heap/container-memory-monitor.h"
 #include "src/heap/conservative-stack-visitor-inl.h"
 #include "src/heap/cppgc-js/cpp-heap.h"
 #include "src/heap/ephemeron-remembered-set.h"
@@ -73,6 +75,7 @@
 #include "src/heap/heap-visitor-inl.h"
 #include "src/heap/heap-visitor.h"
 #include "src/heap/heap-write-barrier-inl.h"
+#include "src/heap/huge-page-manager.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/local-heap-inl.h"
@@ -551,6 +554,13 @@ bool Heap::ShouldOptimizeForBattery() const {
          isolate()->BatterySaverModeEnabled();
 }
 
+bool Heap::ShouldCompactIncrementally() const {
+  if (V8_UNLIKELY(v8_flags.incremental_compaction.value().has_value())) {
+    return *v8_flags.incremental_compaction.value();
+  }
+  return incremental_compaction_enabled_.load(std::memory_order_relaxed);
+}
+
 GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
                                               GarbageCollectionReason gc_reason,
                                               const char** reason) const {
@@ -1110,6 +1120,11 @@ void Heap::GarbageCollectionEpilogueInSafepoint(GarbageCollector collector) {
   UPDATE_COUNTERS_FOR_SPACE(lo_space)
 #undef UPDATE_COUNTERS_FOR_SPACE
 
+  if (HugePageManager* huge_pages = memory_allocator()->huge_page_manager()) {
+    isolate_->counters()->huge_page_backed_bytes()->Set(
+        static_cast<int>(huge_pages->huge_page_backed_bytes()));
+  }
+
 #ifdef DEBUG
   if (v8_flags.print_global_handles) isolate_->global_handles()->Print();
   if (v8_flags.print_handles) PrintHandles();
@@ -1171,6 +1186,30 @@ void Heap::GarbageCollectionEpilogue(GarbageCollector collector) {
 #endif  // DEBUG
 
   last_gc_time_ = MonotonicallyIncreasingTimeInMs();
+
+  if (IsYoungGenerationCollector(collector)) {
+    ScheduleMemoryPoolRefill();
+  }
+
+  CheckContainerMemoryPressure();
+}
+
+void Heap::ScheduleMemoryPoolRefill() {
+  if (v8_flags.memory_pool_max_prefaulted_pages == 0) return;
+  MemoryPool* memory_pool = isolate_->isolate_group()->memory_pool();
+  if (!memory_pool) return;
+  // Pages requested within this horizon should not fault on first use.
+  static constexpr double kRefillHorizonInMs = 100;
+  size_t target_pages = 0;
+  if (!ShouldOptimizeForMemoryUsage()) {
+    const double expected_bytes =
+        tracer()->AllocationThroughputInBytesPerMillisecond() *
+        kRefillHorizonInMs;
+    target_pages = static_cast<size_t>(
+        std::ceil(expected_bytes / NormalPage::kPageSize));
+  }
+  memory_pool->ScheduleRefill(
+      isolate_, memory_allocator()->data_page_allocator(), target_pages);
 }
 
 GCCallbacksScope::GCCallbacksScope(Heap* heap) : heap_(heap) {
@@ -2569,6 +2608,13 @@ void Heap::MarkCompact() {
 
   MarkCompactEpilogue();
 
+  if (HugePageManager* huge_pages = memory_allocator()->huge_page_manager();
+      huge_pages && !ShouldReduceMemory()) {
+    // Memory-reducing GCs leave it to the OS to split huge pages.
+    huge_pages->ScheduleCollapse(isolate(), {old_space(), code_space()},
+                                 v8_flags.huge_pages_max_collapses_per_gc);
+  }
+
   if (v8_flags.allocation_site_pretenuring) {
     EvaluateOldSpaceLocalPretenuring(size_of_objects_before_gc);
   }
@@ -2700,6 +2746,7 @@ void Heap::ProcessAllocationSites(WeakObjectRetainer* retainer) {
   set_allocation_sites_list(
       Cast<UnionOf<Undefined, AllocationSiteWithWeakNext>>(
           allocation_site_obj));
+  pretenuring_handler_.UpdateAllocationSiteLifetimes(retainer);
 }
 
 void Heap::ProcessDirtyJSFinalizationRegistries(WeakObjectRetainer* retainer) {
@@ -2722,6 +2769,7 @@ void Heap::ProcessWeakListRoots(WeakObjectRetainer* retainer) {
       retainer->RetainAs(dirty_js_finalization_registries_list()));
   set_dirty_js_finalization_registries_list_tail(
       retainer->RetainAs(dirty_js_finalization_registries_list_tail()));
+  pretenuring_handler_.UpdateAllocationSiteLifetimes(retainer);
 }
 
 void Heap::AddToWeakNativeContextList(Tagged<Context> context) {
@@ -2774,6 +2822,7 @@ void Heap::ResetAllAllocationSitesDependentCode(AllocationType allocation) {
           site->set_deopt_dependent_code(true);
           marked = true;
           pretenuring_handler_.RemoveAllocationSitePretenuringFeedback(site);
+          pretenuring_handler_.RecordAllocationSiteTenuringReverted(site);
           return;
         }
       });
@@ -4038,6 +4087,19 @@ void Heap::CheckMemoryPressure() {
   }
 }
 
+void Heap::CheckContainerMemoryPressure() {
+  if (!container_memory_monitor_) return;
+  const MemoryPressureLevel level =
+      container_memory_monitor_->Sample(MonotonicallyIncreasingTimeInMs());
+  if (level == MemoryPressureLevel::kNone) return;
+  if (v8_flags.trace_memory_reducer) {
+    isolate()->PrintWithTimestamp(
+        "Container memory pressure: %s\n",
+        level == MemoryPressureLevel::kCritical ? "critical" : "moderate");
+  }
+  MemoryPressureNotification(level, false);
+}
+
 void Heap::CollectGarbageOnMemoryPressure() {
   const int kGarbageThresholdInBytes = 8 * MB;
   const double kGarbageThresholdAsFractionOfTotalMemory = 0.1;
@@ -5011,6 +5073,17 @@ void Heap::ConfigureHeap(const v8::ResourceConstraints& constraints,
                                     ? max_heap_size - young_generation_size
                                     : 0;
     }
+    if (v8_flags.container_memory_awareness) {
+      container_memory_monitor_ = std::make_unique<ContainerMemoryMonitor>();
+      // Sizes configured by the embedder or by flags take precedence over the
+      // container limit.
+      if (constraints.max_old_generation_size_in_bytes() == 0 &&
+          v8_flags.max_old_space_size == 0 && v8_flags.max_heap_size == 0) {
+        max_old_generation_size =
+            container_memory_monitor_->CapMaxOldGenerationSize(
+                max_old_generation_size);
+      }
+    }
     max_old_generation_size =
         std::clamp(max_old_generation_size, MinOldGenerationSize(),
                    kAllocatorLimitOnMaxOldGenerationSize);
@@ -92,6 +92,7 @@ class CodeLargeObjectSpace;
 class CodeRange;
 class CollectionBarrier;
 class ConcurrentMarking;
+class ContainerMemoryMonitor;
 class CppHeap;
 class EphemeronRememberedSet;
 class GCTracer;
@@ -611,6 +612,9 @@ class Heap final {
   V8_EXPORT_PRIVATE void MemoryPressureNotification(
       v8::MemoryPressureLevel level, bool is_isolate_locked);
   void CheckMemoryPressure();
+  // Turns container memory pressure into a memory pressure notification when
+  // --container-memory-awareness is enabled.
+  void CheckContainerMemoryPressure();
 
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
@@ -698,6 +702,15 @@ class Heap final {
   // Returns true when GC should optimize for battery.
   V8_EXPORT_PRIVATE bool ShouldOptimizeForBattery() const;
 
+  // Incremental compaction bounds the amount of live bytes evacuated in a
+  // single atomic pause by a time budget derived from the observed compaction
+  // speed. Fragmented pages that do not fit into the budget are left for
+  // subsequent full GCs.
+  V8_EXPORT_PRIVATE bool ShouldCompactIncrementally() const;
+  void set_incremental_compaction_enabled(bool enabled) {
+    incremental_compaction_enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
   bool HighMemoryPressure() {
     return memory_pressure_level_.load(std::memory_order_relaxed) !=
            v8::MemoryPressureLevel::kNone;
@@ -1920,6 +1933,10 @@ class Heap final {
   void GarbageCollectionEpilogue(GarbageCollector collector);
   void GarbageCollectionEpilogueInSafepoint(GarbageCollector collector);
 
+  // Keeps pooled pages pre-faulted for the allocations that are expected until
+  // the next GC (--memory-pool-max-prefaulted-pages).
+  void ScheduleMemoryPoolRefill();
+
   // Performs a major collection in the whole heap.
   void MarkCompact();
   // Performs a minor collection of just the young generation.
@@ -2139,6 +2156,10 @@ class Heap final {
   // and reset by a mark-compact garbage collection.
   std::atomic<v8::MemoryPressureLevel> memory_pressure_level_;
 
+  // Per-isolate incremental compaction setting. Can be overridden with
+  // --incremental-compaction.
+  std::atomic<bool> incremental_compaction_enabled_{false};
+
   std::vector<std::pair<v8::NearHeapLimitCallback, void*>>
       near_heap_limit_callbacks_;
 
@@ -2278,6 +2299,7 @@ class Heap final {
   std::unique_ptr<ConcurrentMarking> concurrent_marking_;
   std::unique_ptr<MemoryMeasurement> memory_measurement_;
   std::unique_ptr<MemoryReducer> memory_reducer_;
+  std::unique_ptr<ContainerMemoryMonitor> container_memory_monitor_;
   std::unique_ptr<ObjectStats> live_object_stats_;
   std::unique_ptr<ObjectStats> dead_object_stats_;
   std::unique_ptr<MinorGCJob> minor_gc_job_;
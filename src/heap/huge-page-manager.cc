@@ -0,0 +1,152 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/huge-page-manager.h"
+
+#include <unordered_map>
+#include <utility>
+
+#include "src/base/bits.h"
+#include "src/base/platform/platform.h"
+#include "src/flags/flags.h"
+#include "src/heap/normal-page.h"
+#include "src/heap/paged-spaces.h"
+#include "src/init/v8.h"
+#include "src/tasks/cancelable-task.h"
+
+namespace v8::internal {
+
+// static
+std::unique_ptr<HugePageManager> HugePageManager::MaybeCreate() {
+  if (!v8_flags.huge_pages) return {};
+  const size_t huge_page_size = base::OS::HugePageSize();
+  // Regions need to be made up of whole heap pages.
+  if (huge_page_size == 0 || huge_page_size % NormalPage::kPageSize != 0) {
+    return {};
+  }
+  return std::make_unique<HugePageManager>(huge_page_size);
+}
+
+HugePageManager::HugePageManager(size_t huge_page_size)
+    : huge_page_size_(huge_page_size) {
+  DCHECK(base::bits::IsPowerOfTwo(huge_page_size));
+}
+
+void HugePageManager::NotifyChunkAllocated(Address base, size_t size) {
+  base::MutexGuard guard(&mutex_);
+  for (Address region = RegionStart(base); region < base + size;
+       region += huge_page_size_) {
+    chunks_per_region_[region]++;
+    // Advise whole regions instead of individual chunks, so that growing the
+    // heap by a region costs a single system call. This also opts regions
+    // back in after a memory-reducing GC opted them out.
+    if (advised_regions_.insert(region).second) {
+      USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(region),
+                                    huge_page_size_, true));
+    }
+  }
+}
+
+void HugePageManager::NotifyChunkFreed(Address base, size_t size,
+                                       bool reduce_memory) {
+  base::MutexGuard guard(&mutex_);
+  for (Address region = RegionStart(base); region < base + size;
+       region += huge_page_size_) {
+    // Releasing the chunk splits the huge page of the region, and drops the
+    // hint for the chunk's memory.
+    collapsed_regions_.erase(region);
+    advised_regions_.erase(region);
+    auto it = chunks_per_region_.find(region);
+    if (it != chunks_per_region_.end() && --it->second > 0) continue;
+    if (it != chunks_per_region_.end()) chunks_per_region_.erase(it);
+    if (reduce_memory) {
+      // Prevent the OS from refilling the released memory when it collapses
+      // the region in the background. Regions that still contain chunks keep
+      // using huge pages.
+      USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(region),
+                                    huge_page_size_, false));
+    }
+  }
+}
+
+namespace {
+
+class CollapseHugePagesTask final : public CancelableTask {
+ public:
+  CollapseHugePagesTask(Isolate* isolate, HugePageManager* manager,
+                        std::vector<Address> regions)
+      : CancelableTask(isolate),
+        manager_(manager),
+        regions_(std::move(regions)) {}
+
+  ~CollapseHugePagesTask() override = default;
+  CollapseHugePagesTask(const CollapseHugePagesTask&) = delete;
+  CollapseHugePagesTask& operator=(const CollapseHugePagesTask&) = delete;
+
+ private:
+  void RunInternal() override { manager_->CollapseRegions(regions_); }
+
+  HugePageManager* const manager_;
+  const std::vector<Address> regions_;
+};
+
+}  // namespace
+
+void HugePageManager::ScheduleCollapse(
+    Isolate* isolate, std::initializer_list<PagedSpaceBase*> spaces,
+    size_t max_regions) {
+  std::unordered_map<Address, size_t, base::hash<Address>> pages_per_region;
+  for (PagedSpaceBase* space : spaces) {
+    for (NormalPage* page : *space) {
+      pages_per_region[RegionStart(page->ChunkAddress())]++;
+    }
+  }
+  const size_t pages_per_huge_page = huge_page_size_ / NormalPage::kPageSize;
+  std::vector<Address> regions;
+  {
+    base::MutexGuard guard(&mutex_);
+    // Collapsing is best effort: skip this GC if the last task didn't run yet.
+    if (collapse_pending_) return;
+    for (const auto& [region, pages] : pages_per_region) {
+      if (regions.size() == max_regions) break;
+      if (pages != pages_per_huge_page) continue;
+      if (collapsed_regions_.contains(region)) continue;
+      regions.push_back(region);
+    }
+    if (regions.empty()) return;
+    collapse_pending_ = true;
+  }
+  // MADV_COLLAPSE copies the whole region synchronously, which is too slow
+  // for the atomic pause.
+  V8::GetCurrentPlatform()->PostTaskOnWorkerThread(
+      TaskPriority::kBestEffort, std::make_unique<CollapseHugePagesTask>(
+                                     isolate, this, std::move(regions)));
+}
+
+void HugePageManager::CollapseRegions(const std::vector<Address>& regions) {
+  for (Address region : regions) {
+    TryCollapseRegion(region);
+  }
+  base::MutexGuard guard(&mutex_);
+  collapse_pending_ = false;
+}
+
+bool HugePageManager::TryCollapseRegion(Address region) {
+  DCHECK_EQ(region, RegionStart(region));
+  if (!base::OS::CollapseHugePages(reinterpret_cast<void*>(region),
+                                   huge_page_size_)) {
+    return false;
+  }
+  base::MutexGuard guard(&mutex_);
+  // The region may have lost a chunk while it was being collapsed.
+  if (chunks_per_region_.contains(region)) collapsed_regions_.insert(region);
+  return true;
+}
+
+size_t HugePageManager::huge_page_backed_bytes() const {
+  base::MutexGuard guard(&mutex_);
+  return collapsed_regions_.size() * huge_page_size_;
+}
+
+}  // namespace v8::internal
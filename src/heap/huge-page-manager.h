@@ -0,0 +1,84 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_HUGE_PAGE_MANAGER_H_
+#define V8_HEAP_HUGE_PAGE_MANAGER_H_
+
+#include <initializer_list>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "src/base/hashing.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8::internal {
+
+class Isolate;
+class PagedSpaceBase;
+
+// Backs heap memory with transparent huge pages (--huge-pages).
+//
+// Huge page aligned regions are advised to use huge pages when the first chunk
+// in them is allocated. After full GCs regions that are completely covered by
+// heap pages are collapsed by a background task. Memory-reducing GCs opt
+// regions that no longer contain any chunk out of huge pages again, so that
+// the OS does not refill memory that the GC just returned.
+class V8_EXPORT_PRIVATE HugePageManager final {
+ public:
+  // Returns nullptr if huge pages are disabled or not supported by the OS.
+  static std::unique_ptr<HugePageManager> MaybeCreate();
+
+  explicit HugePageManager(size_t huge_page_size);
+
+  HugePageManager(const HugePageManager&) = delete;
+  HugePageManager& operator=(const HugePageManager&) = delete;
+
+  // Called when the chunk [base, base + size) was allocated.
+  void NotifyChunkAllocated(Address base, size_t size);
+
+  // Called when the chunk [base, base + size) is freed. With `reduce_memory`
+  // the regions that no longer contain any chunk opt out of huge pages.
+  void NotifyChunkFreed(Address base, size_t size, bool reduce_memory);
+
+  // Posts a background task collapsing at most `max_regions` regions that are
+  // completely covered by pages of `spaces`. Must be called on the main thread
+  // while the spaces can't change.
+  void ScheduleCollapse(Isolate* isolate,
+                        std::initializer_list<PagedSpaceBase*> spaces,
+                        size_t max_regions);
+
+  // Collapses `regions` one by one. Called by the background task.
+  void CollapseRegions(const std::vector<Address>& regions);
+
+  // Collapses the region starting at `region`, which must be aligned to the
+  // huge page size. Returns false if the OS rejected the request.
+  bool TryCollapseRegion(Address region);
+
+  // Bytes in regions that were collapsed and are still fully in use.
+  size_t huge_page_backed_bytes() const;
+
+  size_t huge_page_size() const { return huge_page_size_; }
+
+ private:
+  Address RegionStart(Address address) const {
+    return RoundDown(address, huge_page_size_);
+  }
+
+  const size_t huge_page_size_;
+  mutable base::Mutex mutex_;
+  // Number of live chunks overlapping each region.
+  std::unordered_map<Address, size_t, base::hash<Address>> chunks_per_region_;
+  // Regions that were advised to use huge pages since they last lost a chunk.
+  std::unordered_set<Address, base::hash<Address>> advised_regions_;
+  std::unordered_set<Address, base::hash<Address>> collapsed_regions_;
+  bool collapse_pending_ = false;
+};
+
+}  // namespace v8::internal
+
+#endif  // V8_HEAP_HUGE_PAGE_MANAGER_H_
@@ -346,10 +346,37 @@ static void TraceFragmentation(PagedSpace* space) {
          static_cast<double>(free) * 100 / reserved);
 }
 
+void MarkCompactCollector::RecordFragmentationHistograms() {
+  DCHECK(!sweeper_->sweeping_in_progress());
+  heap_->old_space()->RecordFragmentationHistogram();
+  heap_->code_space()->RecordFragmentationHistogram();
+  heap_->trusted_space()->RecordFragmentationHistogram();
+  if (heap_->shared_space()) {
+    heap_->shared_space()->RecordFragmentationHistogram();
+  }
+  if (heap_->shared_trusted_space()) {
+    heap_->shared_trusted_space()->RecordFragmentationHistogram();
+  }
+  if (v8_flags.trace_fragmentation) {
+    const PagedSpaceBase::FragmentationHistogram& histogram =
+        heap_->old_space()->fragmentation_histogram();
+    PrintIsolate(heap_->isolate(),
+                 "fragmentation-histogram: space=%s pages per 10%% bucket="
+                 "[%zu %zu %zu %zu %zu %zu %zu %zu %zu %zu]\n",
+                 ToString(OLD_SPACE), histogram[0], histogram[1], histogram[2],
+                 histogram[3], histogram[4], histogram[5], histogram[6],
+                 histogram[7], histogram[8], histogram[9]);
+  }
+}
+
 bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
   DCHECK(!compacting_);
   DCHECK(evacuation_candidates_.empty());
 
+  // Walking all pages for the histograms is only worth it when they are traced
+  // or when the GC goes on to compact.
+  if (v8_flags.trace_fragmentation) RecordFragmentationHistograms();
+
   // Bailouts for completely disabled compaction.
   if (!v8_flags.compact || heap_->isolate()->serializer_enabled()) {
     return false;
@@ -376,6 +403,19 @@ bool MarkCompactCollector::StartCompaction(StartCompactionMode mode) {
     return false;
   }
 
+  // With incremental compaction the evacuated bytes of all spaces are bounded
+  // by the pause budget. Memory reducing GCs are not bounded as they should
+  // release as much memory as possible.
+  incremental_compaction_budget_.reset();
+  if (heap_->ShouldCompactIncrementally() && !heap_->ShouldReduceMemory()) {
+    incremental_compaction_budget_ =
+        heap_->tracer()->CompactionBytesForDuration(
+            base::TimeDelta::FromMillisecondsD(
+                v8_flags.incremental_compaction_pause_budget_ms));
+  }
+
+  if (!v8_flags.trace_fragmentation) RecordFragmentationHistograms();
+
   CollectEvacuationCandidates(heap_->old_space());
 
   // Don't compact shared space when CSS is enabled, since there may be
@@ -545,6 +585,7 @@ void MarkCompactCollector::CollectGarbage() {
   // still intact.
   RecordObjectStats();
   ClearNonLiveReferences();
+  ReportObjectStats();
   VerifyMarking();
 
   if (auto* cpp_heap = CppHeap::From(heap_->cpp_heap_)) {
@@ -655,6 +696,38 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
   }
 }
 
+// static
+double MarkCompactCollector::CompactionBenefit(
+    size_t live_bytes, const NormalPage::FragmentationStats& stats) {
+  // Evacuating a page releases all of its free memory. Free memory that sits
+  // in large free list blocks is still usable for allocation without
+  // compaction though, so it only counts half towards the benefit. The cost is
+  // dominated by copying the live bytes. A fixed per-page overhead accounts
+  // for the remaining per-page work and avoids division by zero.
+  constexpr size_t kPerPageOverheadInBytes = 1 * KB;
+  const size_t benefit =
+      stats.fragmented_bytes + (stats.free_bytes - stats.fragmented_bytes) / 2;
+  return static_cast<double>(benefit) / (live_bytes + kPerPageOverheadInBytes);
+}
+
+// static
+void MarkCompactCollector::SortPagesByCompactionBenefit(
+    std::vector<std::pair<size_t, NormalPage*>>* pages) {
+  std::vector<std::pair<double, std::pair<size_t, NormalPage*>>> scored_pages;
+  scored_pages.reserve(pages->size());
+  for (const auto& entry : *pages) {
+    const double score = CompactionBenefit(
+        entry.first, entry.second->ComputeFragmentationStats());
+    scored_pages.emplace_back(score, entry);
+  }
+  std::stable_sort(
+      scored_pages.begin(), scored_pages.end(),
+      [](const auto& a, const auto& b) { return a.first > b.first; });
+  for (size_t i = 0; i < scored_pages.size(); i++) {
+    (*pages)[i] = scored_pages[i].second;
+  }
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE ||
          space->identity() == SHARED_SPACE ||
@@ -670,6 +743,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   // Those variables will only be initialized if |in_standard_path|, and are not
   // used otherwise.
   size_t max_evacuated_bytes;
+  // The limit that would apply without incremental compaction.
+  size_t unbounded_max_evacuated_bytes;
   int target_fragmentation_percent;
   size_t free_bytes_threshold;
   if (in_standard_path) {
@@ -681,6 +756,11 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     //   compacted.
     ComputeEvacuationHeuristics(area_size, &target_fragmentation_percent,
                                 &max_evacuated_bytes);
+    unbounded_max_evacuated_bytes = max_evacuated_bytes;
+    if (incremental_compaction_budget_.has_value()) {
+      max_evacuated_bytes =
+          std::min(max_evacuated_bytes, *incremental_compaction_budget_);
+    }
     free_bytes_threshold = target_fragmentation_percent * (area_size / 100);
   }
 
@@ -759,17 +839,30 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     // - the total size of evacuated objects does not exceed the specified
     // limit.
     // - fragmentation of (n+1)-th page does not exceed the specified limit.
-    std::sort(pages.begin(), pages.end(),
-              [](const LiveBytesPagePair& a, const LiveBytesPagePair& b) {
-                return a.first < b.first;
-              });
+    //
+    // With --adaptive-evacuation-candidates-selection pages are instead
+    // sorted by the ratio of reclaimed fragmented memory to evacuation cost.
+    if (v8_flags.adaptive_evacuation_candidates_selection) {
+      SortPagesByCompactionBenefit(&pages);
+    } else {
+      std::sort(pages.begin(), pages.end(),
+                [](const LiveBytesPagePair& a, const LiveBytesPagePair& b) {
+                  return a.first < b.first;
+                });
+    }
+    // Candidates are a prefix of |pages|, so selection stops at the first page
+    // exceeding the limit.
+    bool limit_reached = false;
     for (size_t i = 0; i < pages.size(); i++) {
       size_t live_bytes = pages[i].first;
       DCHECK_GE(area_size, live_bytes);
-      if (v8_flags.compact_on_every_full_gc ||
-          ((total_live_bytes + live_bytes) <= max_evacuated_bytes)) {
+      if (!limit_reached &&
+          (v8_flags.compact_on_every_full_gc ||
+           ((total_live_bytes + live_bytes) <= max_evacuated_bytes))) {
         candidate_count++;
         total_live_bytes += live_bytes;
+      } else {
+        limit_reached = true;
       }
       if (v8_flags.trace_fragmentation_verbose) {
         PrintIsolate(heap_->isolate(),
@@ -788,6 +881,7 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
         static_cast<int>((total_live_bytes + area_size - 1) / area_size);
     DCHECK_LE(estimated_new_pages, candidate_count);
     int estimated_released_pages = candidate_count - estimated_new_pages;
+    const int selected_count = candidate_count;
     // Avoid (compact -> expand) cycles.
     if ((estimated_released_pages == 0) && !v8_flags.compact_on_every_full_gc) {
       candidate_count = 0;
@@ -795,6 +889,28 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
+    if (incremental_compaction_budget_.has_value()) {
+      // Fragmented pages that did not fit into the budget are left for
+      // subsequent GCs. Record their live bytes so that the tracer can report
+      // how much evacuation work was moved out of this pause. Pages that
+      // wouldn't have been selected without the budget either are not
+      // deferred.
+      size_t deferred_live_bytes = 0;
+      size_t unbounded_live_bytes = total_live_bytes;
+      for (size_t i = selected_count; i < pages.size(); i++) {
+        if (unbounded_live_bytes + pages[i].first >
+            unbounded_max_evacuated_bytes) {
+          break;
+        }
+        unbounded_live_bytes += pages[i].first;
+        deferred_live_bytes += pages[i].first;
+      }
+      heap_->tracer()->AddDeferredCompaction(deferred_live_bytes);
+      if (candidate_count > 0) {
+        *incremental_compaction_budget_ -=
+            std::min(total_live_bytes, *incremental_compaction_budget_);
+      }
+    }
   }
 
   if (v8_flags.trace_fragmentation) {
@@ -945,8 +1061,11 @@ void MarkCompactCollector::Finish() {
 
   sweeper_->StartMajorSweeperTasks();
 
-  // Release delayed pages now that the pointer-update phase is done.
-  heap_->memory_allocator()->ReleaseDelayedPages();
+  // Release delayed pages now that the pointer-update phase is done. Dead
+  // large pages are handed to the sweeper tasks which unmap them in the
+  // background.
+  heap_->memory_allocator()->ReleaseDelayedPages(/*queue_large_pages=*/true);
+  sweeper_->NotifyLargePagesQueuedForRelease();
 
   // Shrink pages if possible after processing and filtering slots.
   ShrinkPagesToObjectSizes(heap_, heap_->lo_space());
@@ -2486,6 +2605,26 @@ void MarkCompactCollector::RecordObjectStats() {
   ObjectStatsCollector collector(heap_, heap_->live_object_stats_.get(),
                                  heap_->dead_object_stats_.get());
   collector.Collect();
+  object_stats_pending_ = true;
+}
+
+void MarkCompactCollector::ReportObjectStats() {
+  if (V8_LIKELY(!object_stats_pending_)) return;
+  object_stats_pending_ = false;
+  // Memory trimmed from live arrays is reported as dead.
+  auto record_trimmed_bytes = [this](std::atomic<size_t>& counter,
+                                     ObjectStats::VirtualInstanceType type) {
+    const size_t bytes = counter.exchange(0, std::memory_order_relaxed);
+    if (bytes == 0) return;
+    heap_->dead_object_stats_->RecordVirtualObjectStats(
+        Tagged<HeapObject>(), type, bytes, ObjectStats::kNoOverAllocation);
+  };
+  record_trimmed_bytes(
+      trimmed_transition_array_bytes_,
+      ObjectStats::VirtualInstanceType::CLEARED_TRANSITION_ARRAY_ENTRIES_TYPE);
+  record_trimmed_bytes(
+      trimmed_descriptor_array_bytes_,
+      ObjectStats::VirtualInstanceType::TRIMMED_DESCRIPTOR_ARRAY_ENTRIES_TYPE);
   if (V8_UNLIKELY(TracingFlags::gc_stats.load(std::memory_order_relaxed) &
                   v8::tracing::TracingCategoryObserver::ENABLED_BY_TRACING)) {
     std::stringstream live, dead;
@@ -2511,6 +2650,11 @@ bool ShouldRetainMap(Heap* heap, MarkingState* marking_state, Tagged<Map> map,
     // The map has aged. Do not retain this map.
     return false;
   }
+  if (v8_flags.shape_compaction && map->is_deprecated()) {
+    // Deprecated maps are never used for new objects. Drop them as soon as
+    // their last instance was migrated or died.
+    return false;
+  }
   Tagged<Object> constructor = map->GetConstructor();
   if (!IsHeapObject(constructor) ||
       MarkingHelper::IsUnmarkedAndNotAlwaysLive(
@@ -4053,6 +4197,11 @@ bool MarkCompactCollector::CompactTransitionArray(
     const uint32_t new_capacity =
         static_cast<uint32_t>(TransitionArray::ToKeyIndex(transition_index));
     heap_->RightTrimArray(transitions, new_capacity, old_capacity);
+    if (V8_UNLIKELY(object_stats_pending_)) {
+      trimmed_transition_array_bytes_.fetch_add(
+          (old_capacity - new_capacity) * kTaggedSize,
+          std::memory_order_relaxed);
+    }
     transitions->SetNumberOfTransitions(transition_index);
   }
   return descriptors_owner_died;
@@ -4132,6 +4281,11 @@ void MarkCompactCollector::TrimDescriptorArray(
     descriptors->set_number_of_descriptors(number_of_own_descriptors);
     if (can_trim) {
       RightTrimDescriptorArray(heap_, descriptors, to_trim);
+      if (V8_UNLIKELY(object_stats_pending_)) {
+        trimmed_descriptor_array_bytes_.fetch_add(
+            to_trim * DescriptorArray::kEntrySize * kTaggedSize,
+            std::memory_order_relaxed);
+      }
     }
     TrimEnumCache(heap_, map, descriptors);
     descriptors->Sort();
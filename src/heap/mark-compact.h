@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_MARK_COMPACT_H_
 #define V8_HEAP_MARK_COMPACT_H_
 
+#include <atomic>
+#include <optional>
 #include <vector>
 
 #include "absl/container/flat_hash_set.h"
@@ -114,6 +116,15 @@ class MarkCompactCollector final {
   // Returns whether compaction is running.
   bool StartCompaction(StartCompactionMode mode);
 
+  // Ratio of the memory that evacuating a page reclaims to the cost of
+  // evacuating its `live_bytes`.
+  V8_EXPORT_PRIVATE static double CompactionBenefit(
+      size_t live_bytes, const NormalPage::FragmentationStats& stats);
+
+  // Sorts (live bytes, page) pairs by descending CompactionBenefit().
+  V8_EXPORT_PRIVATE static void SortPagesByCompactionBenefit(
+      std::vector<std::pair<size_t, NormalPage*>>* pages);
+
   void StartMarking(
       std::shared_ptr<::heap::base::IncrementalMarkingSchedule> schedule = {});
 
@@ -197,7 +208,13 @@ class MarkCompactCollector final {
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
 
+  void RecordFragmentationHistograms();
+
+  // Object stats are collected after marking, while dead object graphs are
+  // still intact, and reported after clearing such that they include memory
+  // reclaimed from transition trees.
   void RecordObjectStats();
+  void ReportObjectStats();
 
   // Finishes GC, performs heap verification if enabled.
   void Finish();
@@ -402,6 +419,9 @@ class MarkCompactCollector final {
   // True if we are collecting slots to perform evacuation from evacuation
   // candidates.
   bool compacting_ = false;
+  // Remaining live bytes that may be evacuated in the current cycle when
+  // incremental compaction is enabled. Shared across all compacted spaces.
+  std::optional<size_t> incremental_compaction_budget_;
   bool black_allocation_ = false;
   bool have_code_to_deoptimize_ = false;
   bool parallel_marking_ = false;
@@ -452,6 +472,13 @@ class MarkCompactCollector final {
 
   bool use_background_threads_in_cycle_ = false;
 
+  // Set between RecordObjectStats() and ReportObjectStats().
+  bool object_stats_pending_ = false;
+  // Bytes right-trimmed from transition and descriptor arrays while clearing
+  // non-live references. Only tracked when object stats are pending.
+  std::atomic<size_t> trimmed_transition_array_bytes_{0};
+  std::atomic<size_t> trimmed_descriptor_array_bytes_{0};
+
   bool in_conservative_stack_scanning_ = false;
 
   friend class Evacuator;
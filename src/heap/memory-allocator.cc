@@ -4,8 +4,10 @@
 
 #include "src/heap/memory-allocator.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <optional>
+#include <vector>
 
 #include "src/base/address-region.h"
 #include "src/base/macros.h"
@@ -44,7 +46,8 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
       code_page_allocator_(code_page_allocator),
       trusted_page_allocator_(trusted_page_allocator),
       capacity_(RoundUp(capacity, NormalPage::kPageSize)),
-      pool_(page_pool) {
+      pool_(page_pool),
+      huge_page_manager_(HugePageManager::MaybeCreate()) {
   DCHECK_NOT_NULL(data_page_allocator_);
   DCHECK_NOT_NULL(read_only_page_allocator_);
   DCHECK_NOT_NULL(code_page_allocator_);
@@ -52,6 +55,11 @@ MemoryAllocator::MemoryAllocator(Isolate* isolate,
 }
 
 void MemoryAllocator::TearDown() {
+  // Sweeper jobs were cancelled at this point, so this releases all remaining
+  // pages.
+  ReleaseQueuedLargePages();
+  DCHECK_EQ(QueuedLargePagesCount(), 0);
+
   if (auto* pool = memory_pool()) {
     pool->ReleaseOnTearDown(isolate_);
     DCHECK_EQ(pool->GetCount(isolate_), 0);
@@ -160,6 +168,10 @@ Address MemoryAllocator::AllocateAlignedMemory(
   madvise(reinterpret_cast<void*>(base), chunk_size, MADV_DODUMP);
 #endif
 
+  if (huge_page_manager_) {
+    huge_page_manager_->NotifyChunkAllocated(base, chunk_size);
+  }
+
   if (executable == EXECUTABLE) {
     ThreadIsolation::RegisterJitPage(base, chunk_size);
   }
@@ -348,6 +360,11 @@ void MemoryAllocator::PreFreeMemory(MutablePage* chunk_metadata) {
   LOG(isolate_, DeleteEvent("MemoryChunk", chunk_metadata));
   RecordMemoryChunkDestroyed(chunk_metadata);
   UnregisterMutableMemoryChunk(chunk_metadata);
+  if (huge_page_manager_) {
+    huge_page_manager_->NotifyChunkFreed(
+        chunk_metadata->ChunkAddress(), chunk_metadata->size(),
+        isolate_->heap()->ShouldReduceMemory());
+  }
   isolate_->heap()->RememberUnmappedPage(
       reinterpret_cast<Address>(chunk_metadata),
       chunk->IsEvacuationCandidate());
@@ -406,27 +423,73 @@ void MemoryAllocator::Free(MemoryAllocator::FreeMode mode,
   }
 }
 
-void MemoryAllocator::ReleaseDelayedPages() {
+void MemoryAllocator::ReleaseDelayedPage(
+    MutablePage* page, bool queue_large_pages,
+    std::vector<MutablePage*>& large_pages_to_queue) {
+  // Executable pages are always released on the main thread.
+  if (queue_large_pages && page->is_large() && !page->is_executable()) {
+    large_pages_to_queue.push_back(page);
+    return;
+  }
+  PerformFreeMemory(page);
+}
+
+void MemoryAllocator::ReleaseDelayedPages(bool queue_large_pages) {
+  queue_large_pages &= v8_flags.concurrent_large_page_release;
+  std::vector<MutablePage*> large_pages_to_queue;
   for (auto* delayed_page : delayed_then_released_pages_) {
-    PerformFreeMemory(delayed_page);
+    ReleaseDelayedPage(delayed_page, queue_large_pages, large_pages_to_queue);
   }
   delayed_then_released_pages_.clear();
   if (!memory_pool()) {
     DCHECK(delayed_then_pooled_pages_.empty());
     DCHECK(delayed_then_pooled_large_pages_.empty());
-    return;
-  }
-  for (auto* delayed_page : delayed_then_pooled_pages_) {
-    memory_pool()->Add(isolate_, delayed_page);
-  }
-  delayed_then_pooled_pages_.clear();
-  memory_pool()->AddLarge(isolate_, delayed_then_pooled_large_pages_);
-  // AddLarge() leaves pages that couldn't be pooled in the vector to be
-  // released afterwards.
-  for (auto* delayed_page : delayed_then_pooled_large_pages_) {
-    PerformFreeMemory(delayed_page);
+  } else {
+    for (auto* delayed_page : delayed_then_pooled_pages_) {
+      memory_pool()->Add(isolate_, delayed_page);
+    }
+    delayed_then_pooled_pages_.clear();
+    memory_pool()->AddLarge(isolate_, delayed_then_pooled_large_pages_);
+    // AddLarge() leaves pages that couldn't be pooled in the vector to be
+    // released afterwards.
+    for (auto* delayed_page : delayed_then_pooled_large_pages_) {
+      ReleaseDelayedPage(delayed_page, queue_large_pages, large_pages_to_queue);
+    }
+    delayed_then_pooled_large_pages_.clear();
+  }
+  if (large_pages_to_queue.empty()) return;
+  base::MutexGuard guard(&queued_large_pages_mutex_);
+  queued_large_pages_.insert(queued_large_pages_.end(),
+                             large_pages_to_queue.begin(),
+                             large_pages_to_queue.end());
+  queued_large_pages_count_.store(queued_large_pages_.size(),
+                                  std::memory_order_relaxed);
+}
+
+size_t MemoryAllocator::ReleaseQueuedLargePages(size_t max_pages) {
+  // Pages are taken out of the queue in batches such that concurrent callers
+  // don't contend on the mutex for every single unmap.
+  static constexpr size_t kBatchSize = 8;
+  size_t released = 0;
+  std::vector<MutablePage*> batch;
+  while (released < max_pages) {
+    {
+      base::MutexGuard guard(&queued_large_pages_mutex_);
+      const size_t batch_size = std::min(
+          {kBatchSize, max_pages - released, queued_large_pages_.size()});
+      if (batch_size == 0) break;
+      batch.assign(queued_large_pages_.end() - batch_size,
+                   queued_large_pages_.end());
+      queued_large_pages_.resize(queued_large_pages_.size() - batch_size);
+      queued_large_pages_count_.store(queued_large_pages_.size(),
+                                      std::memory_order_relaxed);
+    }
+    for (MutablePage* page : batch) {
+      PerformFreeMemory(page);
+    }
+    released += batch.size();
   }
-  delayed_then_pooled_large_pages_.clear();
+  return released;
 }
 
 NormalPage* MemoryAllocator::AllocatePage(
@@ -438,6 +501,10 @@ NormalPage* MemoryAllocator::AllocatePage(
   if (alloc_mode == AllocationMode::kTryDelayedAndPooled) {
     DCHECK_EQ(executable, NOT_EXECUTABLE);
     chunk_info = AllocateUninitializedPageFromDelayedOrPool(space);
+    if (chunk_info && huge_page_manager_) {
+      huge_page_manager_->NotifyChunkAllocated(
+          reinterpret_cast<Address>(chunk_info->chunk), chunk_info->size);
+    }
   }
   if (!chunk_info) {
     chunk_info = AllocateUninitializedChunk(
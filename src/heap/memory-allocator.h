@@ -6,6 +6,7 @@
 #define V8_HEAP_MEMORY_ALLOCATOR_H_
 
 #include <atomic>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <set>
@@ -17,6 +18,7 @@
 #include "src/base/platform/mutex.h"
 #include "src/common/globals.h"
 #include "src/heap/base-page.h"
+#include "src/heap/huge-page-manager.h"
 #include "src/heap/large-page.h"
 #include "src/heap/mutable-page.h"
 #include "src/heap/spaces.h"
@@ -115,7 +117,21 @@ class MemoryAllocator final {
                               MutablePage* page_metadata);
   void FreeReadOnlyPage(ReadOnlyPage* chunk);
 
-  void ReleaseDelayedPages();
+  // Releases all delayed pages. With `queue_large_pages` and
+  // --concurrent-large-page-release, non-executable large pages that are not
+  // pooled are moved to the concurrent release queue instead of being unmapped
+  // right away. The pages are already unregistered and accounted as freed at
+  // this point.
+  void ReleaseDelayedPages(bool queue_large_pages = false);
+
+  // Unmaps at most `max_pages` pages from the concurrent release queue. Can be
+  // called from any thread. Returns the number of released pages.
+  V8_EXPORT_PRIVATE size_t ReleaseQueuedLargePages(
+      size_t max_pages = std::numeric_limits<size_t>::max());
+
+  size_t QueuedLargePagesCount() const {
+    return queued_large_pages_count_.load(std::memory_order_relaxed);
+  }
 
   // Returns allocated spaces in bytes.
   size_t Size() const { return size_; }
@@ -226,6 +242,11 @@ class MemoryAllocator final {
   // Releases all pooled chunks for this isolate immediately.
   V8_EXPORT_PRIVATE void ReleasePooledChunksImmediately();
 
+  // Returns nullptr unless heap memory is backed by huge pages.
+  HugePageManager* huge_page_manager() const {
+    return huge_page_manager_.get();
+  }
+
 #ifdef DEBUG
   // Checks if an allocated MemoryChunk was intended to be used for executable
   // memory.
@@ -378,6 +399,7 @@ class MemoryAllocator final {
 
   std::optional<VirtualMemory> reserved_chunk_at_virtual_memory_limit_;
   MemoryPool* pool_;
+  std::unique_ptr<HugePageManager> huge_page_manager_;
 
 #ifdef DEBUG
   // Data structure to remember allocated executable memory chunks.
@@ -408,6 +430,17 @@ class MemoryAllocator final {
   // Set of delayed then released pages. No reuse is possible here.
   std::vector<MutablePage*> delayed_then_released_pages_;
 
+  // Pre-freed large pages that are unmapped by the sweeper, the memory reducer
+  // or at the latest on teardown.
+  base::Mutex queued_large_pages_mutex_;
+  std::vector<MutablePage*> queued_large_pages_;
+  std::atomic<size_t> queued_large_pages_count_ = 0;
+
+  // Frees `page` immediately or appends it to `large_pages_to_queue` if it
+  // can be released concurrently.
+  void ReleaseDelayedPage(MutablePage* page, bool queue_large_pages,
+                          std::vector<MutablePage*>& large_pages_to_queue);
+
   V8_EXPORT_PRIVATE static size_t commit_page_size_;
   V8_EXPORT_PRIVATE static size_t commit_page_size_bits_;
 
@@ -5,6 +5,8 @@
 #include "src/heap/memory-pool.h"
 
 #include <algorithm>
+#include <cstring>
+#include <utility>
 
 #include "src/base/platform/mutex.h"
 #include "src/common/ptr-compr-inl.h"
@@ -73,6 +75,45 @@ PooledPage PooledPage::Create(LargePage* metadata, Epoch epoch) {
   return PooledPage(metadata, std::move(chunk_reservation), epoch);
 }
 
+// static
+std::optional<PooledPage> PooledPage::Allocate(
+    v8::PageAllocator* page_allocator, Epoch epoch) {
+  VirtualMemory reservation(page_allocator, NormalPage::kPageSize,
+                            PageAllocator::AllocationHint(),
+                            MemoryChunk::GetAlignmentForAllocation(),
+                            PageAllocator::kReadWrite);
+  if (!reservation.IsReserved()) return std::nullopt;
+  // See MemoryAllocator::AllocateAlignedMemory(): The last chunk in the
+  // address space cannot be used for linear allocation areas.
+  if (reservation.end() == 0u) {
+    reservation.Free();
+    return std::nullopt;
+  }
+  void* uninitialized_metadata = malloc(sizeof(NormalPage));
+  if (!uninitialized_metadata) {
+    reservation.Free();
+    return std::nullopt;
+  }
+  PooledPage page(uninitialized_metadata, std::move(reservation), epoch);
+  page.resident_ = false;
+  return {std::move(page)};
+}
+
+void PooledPage::Discard() {
+  DCHECK(reservation_.IsReserved());
+  if (!resident_) return;
+  reservation_.DiscardSystemPages(reservation_.address(), reservation_.size());
+  resident_ = false;
+}
+
+void PooledPage::Prefault() {
+  DCHECK(reservation_.IsReserved());
+  if (resident_) return;
+  memset(reinterpret_cast<void*>(reservation_.address()), 0,
+         reservation_.size());
+  resident_ = true;
+}
+
 PooledPage::~PooledPage() {
   if (!reservation_.IsReserved()) {
     return;
@@ -109,6 +150,43 @@ void MemoryPool::PoolImpl<PoolEntry>::PutLocal(Isolate* isolate,
   local_pools_[isolate].emplace_back(std::move(entry));
 }
 
+template <typename PoolEntry>
+void MemoryPool::PoolImpl<PoolEntry>::PutLocalFront(
+    Isolate* isolate, std::vector<PoolEntry> entries) {
+  if (entries.empty()) return;
+  base::MutexGuard guard(&mutex_);
+  std::vector<PoolEntry>& local_entries = local_pools_[isolate];
+  local_entries.insert(local_entries.begin(),
+                       std::make_move_iterator(entries.begin()),
+                       std::make_move_iterator(entries.end()));
+}
+
+template <typename PoolEntry>
+template <typename Predicate>
+std::vector<PoolEntry> MemoryPool::PoolImpl<PoolEntry>::TakeLocalIf(
+    Isolate* isolate, Predicate predicate) {
+  base::MutexGuard guard(&mutex_);
+  auto it = local_pools_.find(isolate);
+  if (it == local_pools_.end()) return {};
+  std::vector<PoolEntry>& local_entries = it->second;
+  const size_t size = local_entries.size();
+  std::vector<PoolEntry> taken;
+  std::vector<PoolEntry> kept;
+  for (size_t i = 0; i < size; i++) {
+    if (predicate(i, size, std::as_const(local_entries[i]))) {
+      taken.push_back(std::move(local_entries[i]));
+    } else {
+      kept.push_back(std::move(local_entries[i]));
+    }
+  }
+  if (kept.empty()) {
+    local_pools_.erase(it);
+  } else {
+    local_entries = std::move(kept);
+  }
+  return taken;
+}
+
 template <typename PoolEntry>
 std::optional<PoolEntry> MemoryPool::PoolImpl<PoolEntry>::Get(
     Isolate* isolate) {
@@ -195,6 +273,17 @@ size_t MemoryPool::PoolImpl<PoolEntry>::LocalSize(Isolate* isolate) const {
   return (it != local_pools_.end()) ? it->second.size() : 0;
 }
 
+template <typename PoolEntry>
+template <typename Predicate>
+size_t MemoryPool::PoolImpl<PoolEntry>::LocalCountIf(
+    Isolate* isolate, Predicate predicate) const {
+  base::MutexGuard guard(&mutex_);
+  const auto it = local_pools_.find(isolate);
+  if (it == local_pools_.end()) return 0;
+  return static_cast<size_t>(
+      std::count_if(it->second.begin(), it->second.end(), predicate));
+}
+
 template <typename PoolEntry>
 size_t MemoryPool::PoolImpl<PoolEntry>::SharedSize() const {
   base::MutexGuard guard(&mutex_);
@@ -349,6 +438,12 @@ MemoryPool::MemoryPool(Config config)
 MemoryPool::~MemoryPool() = default;
 
 void MemoryPool::ReleaseOnTearDown(Isolate* isolate) {
+  {
+    // Refill tasks are bound to the isolate and have been cancelled already.
+    base::MutexGuard guard(&refill_mutex_);
+    pending_refills_.erase(isolate);
+  }
+
   if (!config_.share_memory_on_teardown) {
     ReleaseImmediately(isolate);
     return;
@@ -399,6 +494,11 @@ size_t MemoryPool::GetCount(Isolate* isolate) const {
   return page_pool_.LocalSize(isolate);
 }
 
+size_t MemoryPool::GetResidentCount(Isolate* isolate) const {
+  return page_pool_.LocalCountIf(
+      isolate, [](const PooledPage& page) { return page.is_resident(); });
+}
+
 size_t MemoryPool::GetSharedCount() const { return page_pool_.SharedSize(); }
 
 size_t MemoryPool::GetTotalCount() const { return page_pool_.Size(); }
@@ -494,6 +594,108 @@ class MemoryPool::ReleasePooledChunksTask final : public CancelableTask {
   const Epoch release_epoch_;
 };
 
+class MemoryPool::RefillPooledPagesTask final : public CancelableTask {
+ public:
+  RefillPooledPagesTask(Isolate* isolate, MemoryPool* pool,
+                        v8::PageAllocator* page_allocator, size_t target_pages)
+      // The task is bound to the isolate as it operates on its local pool,
+      // which is handed off on isolate teardown.
+      : CancelableTask(isolate),
+        isolate_(isolate),
+        pool_(pool),
+        page_allocator_(page_allocator),
+        target_pages_(target_pages) {}
+
+  ~RefillPooledPagesTask() override = default;
+  RefillPooledPagesTask(const RefillPooledPagesTask&) = delete;
+  RefillPooledPagesTask& operator=(const RefillPooledPagesTask&) = delete;
+
+ private:
+  void RunInternal() override {
+    {
+      base::MutexGuard guard(&pool_->refill_mutex_);
+      pool_->pending_refills_.erase(isolate_);
+    }
+    pool_->Refill(isolate_, page_allocator_, target_pages_);
+  }
+
+  Isolate* const isolate_;
+  MemoryPool* const pool_;
+  v8::PageAllocator* const page_allocator_;
+  const size_t target_pages_;
+};
+
+void MemoryPool::ScheduleRefill(Isolate* isolate,
+                                v8::PageAllocator* page_allocator,
+                                size_t target_pages) {
+  DCHECK_NOT_NULL(isolate);
+  // Pre-faulting on the main thread would only move the page faults around.
+  if (config_.max_prefaulted_pages == 0 || config_.single_threaded) return;
+  target_pages = std::min(target_pages, config_.max_prefaulted_pages);
+  if (target_pages == page_pool_.LocalSize(isolate) &&
+      target_pages == GetResidentCount(isolate)) {
+    return;
+  }
+  {
+    base::MutexGuard guard(&refill_mutex_);
+    if (!pending_refills_.insert(isolate).second) return;
+  }
+  V8::GetCurrentPlatform()->PostTaskOnWorkerThread(
+      TaskPriority::kUserVisible,
+      std::make_unique<RefillPooledPagesTask>(isolate, this, page_allocator,
+                                              target_pages));
+}
+
+void MemoryPool::Refill(Isolate* isolate, v8::PageAllocator* page_allocator,
+                        size_t target_pages) {
+  target_pages = std::min(target_pages, config_.max_prefaulted_pages);
+  const Epoch epoch = current_epoch_.load(std::memory_order_relaxed);
+  // Allocate missing pages before taking the local pool, so that the pool
+  // remains usable while the memory is being faulted in.
+  std::vector<PooledPage> fresh_pages;
+  for (size_t pages = page_pool_.LocalSize(isolate); pages < target_pages;
+       pages++) {
+    std::optional<PooledPage> page =
+        PooledPage::Allocate(page_allocator, epoch);
+    if (!page) break;
+    page->Prefault();
+    fresh_pages.push_back(std::move(*page));
+  }
+
+  // Pages are handed out from the back of the pool. Pages in front that exceed
+  // the target are discarded, all others are made resident. Only the pages
+  // whose residency changes are taken out of the pool, so that the isolate
+  // keeps allocating from the other pages in the meantime.
+  std::vector<PooledPage> pages = page_pool_.TakeLocalIf(
+      isolate, [target_pages](size_t index, size_t size,
+                              const PooledPage& page) {
+        const size_t surplus = size > target_pages ? size - target_pages : 0;
+        return index < surplus ? page.is_resident() : !page.is_resident();
+      });
+  size_t discarded = 0;
+  size_t prefaulted = fresh_pages.size();
+  for (PooledPage& page : pages) {
+    if (page.is_resident()) {
+      page.Discard();
+      discarded++;
+    } else {
+      page.Prefault();
+      prefaulted++;
+    }
+  }
+  pages.insert(pages.end(), std::make_move_iterator(fresh_pages.begin()),
+               std::make_move_iterator(fresh_pages.end()));
+  page_pool_.PutLocalFront(isolate, std::move(pages));
+  PostDelayedReleaseTaskIfNeeded(isolate);
+
+  if (config_.trace_gc_nvp) {
+    isolate->PrintWithTimestamp(
+        "Memory pool: Refilled to %zu pages, prefaulted pages: %zu, discarded "
+        "pages: %zu\n",
+        target_pages, prefaulted, discarded);
+  }
+}
+
 void MemoryPool::PostDelayedReleaseTask(Isolate* isolate,
                                         base::TimeDelta delay) {
   DCHECK(config_.timeout_in_sec != 0);
@@ -6,6 +6,7 @@
 #define V8_HEAP_MEMORY_POOL_H_
 
 #include "absl/container/flat_hash_map.h"
+#include "absl/container/flat_hash_set.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/time.h"
 #include "src/utils/allocation.h"
@@ -45,6 +46,17 @@ class PooledPage final {
   size_t size() const { return reservation_.size(); }
   size_t epoch() const { return epoch_; }
 
+  // Whether the page is backed by physical memory. Pages are resident when
+  // they enter the pool.
+  bool is_resident() const { return resident_; }
+
+  // Returns the physical memory of the page to the OS but keeps the
+  // reservation. The next write to the page faults the memory back in.
+  void Discard();
+
+  // Zeroes the page, which faults in all of its physical memory.
+  void Prefault();
+
   // Transfers ownership to a `Result` that is then used by the callers to
   // initialize the chunk and metadata.
   Result ToResult();
@@ -57,6 +69,10 @@ class PooledPage final {
   static PooledPage Create(NormalPage* metadata, Epoch epoch);
   static PooledPage Create(LargePage* metadata, Epoch epoch);
 
+  // Allocates a fresh non-resident regular page from `page_allocator`.
+  static std::optional<PooledPage> Allocate(v8::PageAllocator* page_allocator,
+                                            Epoch epoch);
+
   PooledPage(void* uninitialized_metadata, VirtualMemory reservation,
              Epoch epoch);
 
@@ -64,6 +80,7 @@ class PooledPage final {
   // The reservation that was previously used by MemoryChunk.
   VirtualMemory reservation_;
   Epoch epoch_;
+  bool resident_ = true;
 };
 
 // Pool that keeps memory cached until explicitly flushed. The pool assumes that
@@ -84,6 +101,9 @@ class MemoryPool final {
     bool trace_gc_nvp = false;
     size_t max_large_page_pool_size = 32;
     size_t timeout_in_sec = 8;
+    // Maximum number of pages per isolate that are kept pre-faulted. 0
+    // disables pre-faulting.
+    size_t max_prefaulted_pages = 0;
   };
 
   explicit MemoryPool(Config);
@@ -137,9 +157,25 @@ class MemoryPool final {
   // Notifies the pool that a GC is going to start.
   void GarbageCollectionPrologue(Isolate* isolate, GarbageCollector collector);
 
+  // Posts a background task which refills the local pool of `isolate` to
+  // `target_pages` pages backed by physical memory. Missing pages are
+  // allocated from `page_allocator` and pre-faulted, pages exceeding the target
+  // are discarded. The target is capped to `Config::max_prefaulted_pages`.
+  void ScheduleRefill(Isolate* isolate, v8::PageAllocator* page_allocator,
+                      size_t target_pages);
+
+  // Synchronous version of the task posted by ScheduleRefill().
+  V8_EXPORT_PRIVATE void Refill(Isolate* isolate,
+                                v8::PageAllocator* page_allocator,
+                                size_t target_pages);
+
   // Returns the number of pages in the local pool for the given isolate.
   size_t GetCount(Isolate* isolate) const;
 
+  // Returns the number of resident pages in the local pool for the given
+  // isolate.
+  size_t GetResidentCount(Isolate* isolate) const;
+
   // Returns the number of pages in the shared pool.
   size_t GetSharedCount() const;
 
@@ -152,6 +188,7 @@ class MemoryPool final {
 
  private:
   class ReleasePooledChunksTask;
+  class RefillPooledPagesTask;
 
   struct PoolReleaseStats {
     size_t removed_entries = 0;
@@ -169,6 +206,14 @@ class MemoryPool final {
     }
 
     void PutLocal(Isolate* isolate, PoolEntry entry);
+    // Inserts `entries` in front of the local pool of `isolate`, i.e., they
+    // are handed out after the entries already in the pool.
+    void PutLocalFront(Isolate* isolate, std::vector<PoolEntry> entries);
+    // Removes the entries of the local pool of `isolate` for which
+    // `predicate(index, size, entry)` holds, where `index` counts from the
+    // front of the pool and `size` is the size of the pool.
+    template <typename Predicate>
+    std::vector<PoolEntry> TakeLocalIf(Isolate* isolate, Predicate predicate);
     std::optional<PoolEntry> Get(Isolate* isolate);
     bool MoveLocalToShared(Isolate* isolate);
     void ReleaseShared();
@@ -180,6 +225,8 @@ class MemoryPool final {
 
     size_t Size() const;
     size_t LocalSize(Isolate* isolate) const;
+    template <typename Predicate>
+    size_t LocalCountIf(Isolate* isolate, Predicate predicate) const;
     size_t SharedSize() const;
 
    private:
@@ -248,6 +295,9 @@ class MemoryPool final {
   ReleaseStats ReleaseUpTo(Epoch release_epoch);
 
   std::atomic<Epoch> current_epoch_{0};
+  base::Mutex refill_mutex_;
+  // Isolates for which a refill task is posted but did not run yet.
+  absl::flat_hash_set<Isolate*> pending_refills_;
   std::atomic<base::TimeTicks> posted_time_;
   std::unique_ptr<CancelableTaskManager> cancellable_task_manager_;
 
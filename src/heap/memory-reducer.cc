@@ -9,6 +9,7 @@
 #include "src/heap/heap-inl.h"
 #include "src/heap/incremental-marking.h"
 #include "src/heap/local-heap-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/init/v8.h"
 #include "src/utils/utils.h"
 
@@ -55,7 +56,14 @@ void MemoryReducer::TimerTask::RunInternal() {
       heap->OldGenerationAllocationCounter(), heap->EmbedderAllocationCounter(),
       heap->ExternalAllocationCounter());
   const bool low_allocation_rate = heap->HasLowAllocationRate();
+  // Container memory pressure is reported as regular memory pressure which
+  // makes the heap optimize for memory.
+  heap->CheckContainerMemoryPressure();
   const bool optimize_for_memory = heap->ShouldOptimizeForMemoryUsage();
+  if (optimize_for_memory) {
+    // Don't wait for the sweeper to unmap dead large pages under pressure.
+    heap->memory_allocator()->ReleaseQueuedLargePages();
+  }
   if (v8_flags.trace_memory_reducer) {
     heap->isolate()->PrintWithTimestamp(
         "Memory reducer: %s, %s\n",
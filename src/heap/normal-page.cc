@@ -57,6 +57,25 @@ void NormalPage::ReleaseFreeListCategories() {
   }
 }
 
+NormalPage::FragmentationStats NormalPage::ComputeFragmentationStats() {
+  DCHECK(SweepingDone());
+  FreeList* free_list = owner()->free_list();
+  const FreeListCategoryType first_usable_category =
+      free_list->SelectFreeListCategoryType(
+          FragmentationStats::kFragmentedBlockSize);
+  FragmentationStats stats;
+  stats.free_bytes = area_size() - allocated_bytes();
+  stats.fragmented_bytes = wasted_memory();
+  if (categories_ != nullptr) {
+    for (int i = kFirstCategory; i < first_usable_category; i++) {
+      if (categories_[i] == nullptr) continue;
+      stats.fragmented_bytes += categories_[i]->available();
+    }
+  }
+  DCHECK_LE(stats.fragmented_bytes, stats.free_bytes);
+  return stats;
+}
+
 NormalPage* NormalPage::ConvertNewToOld(NormalPage* old_page,
                                         FreeMode free_mode) {
   DCHECK(old_page);
@@ -86,6 +86,25 @@ class NormalPage final : public MutablePage {
     return categories_[type];
   }
 
+  // Free memory on a page split by how useful it is for allocation. Free list
+  // blocks smaller than `kFragmentedBlockSize` can only serve small
+  // allocations and are considered fragmented, as is memory that the sweeper
+  // accounted as wasted because it was too small for the free list.
+  struct FragmentationStats {
+    static constexpr size_t kFragmentedBlockSize = 1 * KB;
+
+    size_t free_bytes = 0;
+    size_t fragmented_bytes = 0;
+
+    // Fragmented free memory in percent of `area_size`.
+    int FragmentationPercent(size_t area_size) const {
+      return static_cast<int>(fragmented_bytes * 100 / area_size);
+    }
+  };
+
+  // Requires sweeping of the page to be completed.
+  V8_EXPORT_PRIVATE FragmentationStats ComputeFragmentationStats();
+
   V8_EXPORT_PRIVATE void CreateBlackArea(Address start, Address end);
   void DestroyBlackArea(Address start, Address end);
   void ClearBlackAllocation();
@@ -26,6 +26,7 @@
   V(BOILERPLATE_PROPERTY_DICTIONARY_TYPE)        \
   V(BYTECODE_ARRAY_CONSTANT_POOL_TYPE)           \
   V(BYTECODE_ARRAY_HANDLER_TABLE_TYPE)           \
+  V(CLEARED_TRANSITION_ARRAY_ENTRIES_TYPE)       \
   V(COW_ARRAY_TYPE)                              \
   V(DEOPTIMIZATION_DATA_TYPE)                    \
   V(DEPENDENT_CODE_TYPE)                         \
@@ -82,6 +83,7 @@
   V(STRING_EXTERNAL_RESOURCE_ONE_BYTE_TYPE)      \
   V(STRING_EXTERNAL_RESOURCE_TWO_BYTE_TYPE)      \
   V(SOURCE_POSITION_TABLE_TYPE)                  \
+  V(TRIMMED_DESCRIPTOR_ARRAY_ENTRIES_TYPE)       \
   V(UNCOMPILED_SHARED_FUNCTION_INFO_TYPE)        \
   V(WASTED_DESCRIPTOR_ARRAY_DETAILS_TYPE)        \
   V(WASTED_DESCRIPTOR_ARRAY_VALUES_TYPE)         \
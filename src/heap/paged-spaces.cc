@@ -306,6 +306,17 @@ int PagedSpaceBase::CountTotalPages() const {
   return base::checked_cast<int>(std::distance(begin(), end()));
 }
 
+void PagedSpaceBase::RecordFragmentationHistogram() {
+  FragmentationHistogram histogram{};
+  for (NormalPage* page : *this) {
+    const size_t percent = static_cast<size_t>(
+        page->ComputeFragmentationStats().FragmentationPercent(
+            page->area_size()));
+    histogram[std::min(percent / 10, kFragmentationHistogramBuckets - 1)]++;
+  }
+  fragmentation_histogram_ = histogram;
+}
+
 size_t PagedSpaceBase::Available() const {
   ConcurrentAllocationMutex guard(this);
   return free_list_->Available();
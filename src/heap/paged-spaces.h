@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_PAGED_SPACES_H_
 #define V8_HEAP_PAGED_SPACES_H_
 
+#include <array>
 #include <atomic>
 #include <limits>
 #include <memory>
@@ -235,6 +236,20 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
   // Returns the number of total pages in this space.
   int CountTotalPages() const;
 
+  static constexpr size_t kFragmentationHistogramBuckets = 10;
+  using FragmentationHistogram =
+      std::array<size_t, kFragmentationHistogramBuckets>;
+
+  // Buckets pages by their fragmentation percentage (see
+  // NormalPage::FragmentationStats) in steps of 10%. Requires sweeping to be
+  // completed.
+  void RecordFragmentationHistogram();
+  // Returns the histogram recorded at the start of the last full GC that
+  // selected evacuation candidates, or that ran with --trace-fragmentation.
+  const FragmentationHistogram& fragmentation_histogram() const {
+    return fragmentation_histogram_;
+  }
+
   // Return size of allocatable area on a page in this space.
   inline int AreaSize() const { return static_cast<int>(area_size_); }
 
@@ -331,6 +346,8 @@ class V8_EXPORT_PRIVATE PagedSpaceBase
   // Used for tracking bytes allocated since last gc in new space.
   size_t size_at_last_gc_ = 0;
 
+  FragmentationHistogram fragmentation_histogram_{};
+
  private:
   template <bool during_sweep>
   V8_INLINE size_t FreeInternal(Address start, size_t size_in_bytes);
@@ -4,6 +4,11 @@
 
 #include "src/heap/pretenuring-handler.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
 #include "src/common/globals.h"
 #include "src/execution/isolate.h"
 #include "src/flags/flags.h"
@@ -18,6 +23,36 @@
 namespace v8 {
 namespace internal {
 
+void AllocationSiteLifetime::AddSample(double survival_ratio, double weight) {
+  const double decay = v8_flags.allocation_site_lifetime_decay;
+  for (double& bucket : buckets_) {
+    bucket *= decay;
+  }
+  const int index = std::clamp(static_cast<int>(survival_ratio * kBuckets), 0,
+                               kBuckets - 1);
+  buckets_[index] += weight;
+}
+
+double AllocationSiteLifetime::samples() const {
+  return std::accumulate(buckets_.begin(), buckets_.end(), 0.0);
+}
+
+double AllocationSiteLifetime::FractionAtOrAbove(double ratio) const {
+  const double total = samples();
+  if (total == 0.0) return 0.0;
+  // Samples are assumed to be spread evenly within their bucket, so that a
+  // threshold in the middle of a bucket (e.g. the ones used with minor_ms)
+  // counts the part of the bucket above it.
+  const double position =
+      std::clamp(ratio * kBuckets, 0.0, static_cast<double>(kBuckets));
+  const int bucket = std::min(static_cast<int>(position), kBuckets - 1);
+  const double partial =
+      buckets_[bucket] * std::max(0.0, bucket + 1 - position);
+  return (partial + std::accumulate(buckets_.begin() + bucket + 1,
+                                    buckets_.end(), 0.0)) /
+         total;
+}
+
 PretenuringHandler::PretenuringHandler(Heap* heap)
     : heap_(heap), global_pretenuring_feedback_(kInitialFeedbackCapacity) {}
 
@@ -68,6 +103,40 @@ inline bool MakePretenureDecision(
   return false;
 }
 
+// Number of (decayed) samples a lifetime histogram needs before it is used for
+// pretenuring decisions.
+static constexpr double kMinLifetimeSamples = 2.0;
+// Hysteresis band for lifetime based decisions: Sites are tenured when at least
+// kTenureLongLivedFraction of their samples survived, and not tenured when at
+// most kDontTenureLongLivedFraction did. Decisions in between are kept.
+static constexpr double kTenureLongLivedFraction = 0.75;
+static constexpr double kDontTenureLongLivedFraction = 0.25;
+
+inline bool MakeLifetimePretenureDecision(
+    Tagged<AllocationSite> site,
+    AllocationSite::PretenureDecision current_decision,
+    const AllocationSiteLifetime& lifetime,
+    bool new_space_capacity_was_above_pretenuring_threshold,
+    size_t new_space_capacity) {
+  // Tenured sites are only reverted when their objects die in the old
+  // generation, see Heap::ResetAllAllocationSitesDependentCode().
+  if (current_decision == AllocationSite::kTenure) return false;
+  if (lifetime.samples() < kMinLifetimeSamples) return false;
+  const double long_lived = lifetime.FractionAtOrAbove(
+      GetPretenuringRatioThreshold(new_space_capacity));
+  if (long_lived >= kTenureLongLivedFraction) {
+    if (new_space_capacity_was_above_pretenuring_threshold) {
+      site->set_deopt_dependent_code(true);
+      site->set_pretenure_decision(AllocationSite::kTenure);
+      return true;
+    }
+    site->set_pretenure_decision(AllocationSite::kMaybeTenure);
+  } else if (long_lived <= kDontTenureLongLivedFraction) {
+    site->set_pretenure_decision(AllocationSite::kDontTenure);
+  }
+  return false;
+}
+
 // Clear feedback calculation fields until the next gc.
 inline void ResetPretenuringFeedback(Tagged<AllocationSite> site) {
   site->set_memento_found_count(0);
@@ -76,6 +145,7 @@ inline void ResetPretenuringFeedback(Tagged<AllocationSite> site) {
 
 inline bool DigestPretenuringFeedback(
     Isolate* isolate, Tagged<AllocationSite> site,
+    PretenuringHandler::AllocationSiteLifetimeMap* lifetimes,
     bool new_space_capacity_was_above_pretenuring_threshold,
     size_t new_space_capacity) {
   bool deopt = false;
@@ -90,10 +160,22 @@ inline bool DigestPretenuringFeedback(
   AllocationSite::PretenureDecision current_decision =
       site->pretenure_decision();
 
+  const AllocationSiteLifetime* lifetime = nullptr;
   if (minimum_mementos_created) {
-    deopt = MakePretenureDecision(
-        site, current_decision, ratio,
-        new_space_capacity_was_above_pretenuring_threshold, new_space_capacity);
+    if (v8_flags.allocation_site_lifetime_histogram) {
+      AllocationSiteLifetime& site_lifetime = (*lifetimes)[site];
+      site_lifetime.AddSample(ratio);
+      lifetime = &site_lifetime;
+      deopt = MakeLifetimePretenureDecision(
+          site, current_decision, *lifetime,
+          new_space_capacity_was_above_pretenuring_threshold,
+          new_space_capacity);
+    } else {
+      deopt = MakePretenureDecision(
+          site, current_decision, ratio,
+          new_space_capacity_was_above_pretenuring_threshold,
+          new_space_capacity);
+    }
   }
 
   if (V8_UNLIKELY(v8_flags.trace_pretenuring_statistics)) {
@@ -103,6 +185,20 @@ inline bool DigestPretenuringFeedback(
                  reinterpret_cast<void*>(site.ptr()), create_count, found_count,
                  ratio, site->PretenureDecisionName(current_decision),
                  site->PretenureDecisionName(site->pretenure_decision()));
+    if (lifetime) {
+      std::ostringstream histogram;
+      for (int i = 0; i < AllocationSiteLifetime::kBuckets; i++) {
+        histogram << (i > 0 ? " " : "") << std::fixed << std::setprecision(2)
+                  << lifetime->bucket(i);
+      }
+      PrintIsolate(isolate,
+                   "pretenuring: AllocationSite(%p): lifetime (samples, "
+                   "long_lived) (%.2f, %.2f) histogram [%s]\n",
+                   reinterpret_cast<void*>(site.ptr()), lifetime->samples(),
+                   lifetime->FractionAtOrAbove(
+                       GetPretenuringRatioThreshold(new_space_capacity)),
+                   histogram.str().c_str());
+    }
   }
 
   if (V8_UNLIKELY(isolate->heap()->is_gc_tracing_category_enabled())) {
@@ -117,6 +213,12 @@ inline bool DigestPretenuringFeedback(
                    site->PretenureDecisionName(current_decision));
           dict.Add("new_decision",
                    site->PretenureDecisionName(site->pretenure_decision()));
+          if (lifetime) {
+            dict.Add("lifetime_samples", lifetime->samples());
+            dict.Add("long_lived_fraction",
+                     lifetime->FractionAtOrAbove(
+                         GetPretenuringRatioThreshold(new_space_capacity)));
+          }
         });
   }
 
@@ -199,6 +301,34 @@ void PretenuringHandler::RemoveAllocationSitePretenuringFeedback(
   global_pretenuring_feedback_.erase(site);
 }
 
+const AllocationSiteLifetime* PretenuringHandler::GetAllocationSiteLifetime(
+    Tagged<AllocationSite> site) const {
+  auto it = allocation_site_lifetimes_.find(site);
+  return it != allocation_site_lifetimes_.end() ? &it->second : nullptr;
+}
+
+void PretenuringHandler::RecordAllocationSiteTenuringReverted(
+    Tagged<AllocationSite> site) {
+  auto it = allocation_site_lifetimes_.find(site);
+  if (it == allocation_site_lifetimes_.end()) return;
+  // Weighing the sample as much as the whole history more than halves the
+  // long-lived fraction of the site.
+  it->second.AddSample(0.0, it->second.samples());
+}
+
+void PretenuringHandler::UpdateAllocationSiteLifetimes(
+    WeakObjectRetainer* retainer) {
+  if (allocation_site_lifetimes_.empty()) return;
+  AllocationSiteLifetimeMap updated_lifetimes;
+  updated_lifetimes.reserve(allocation_site_lifetimes_.size());
+  for (auto& [site, lifetime] : allocation_site_lifetimes_) {
+    Tagged<Object> retained = retainer->RetainAs(site);
+    if (!IsAllocationSite(retained)) continue;
+    updated_lifetimes.emplace(Cast<AllocationSite>(retained), lifetime);
+  }
+  allocation_site_lifetimes_ = std::move(updated_lifetimes);
+}
+
 void PretenuringHandler::ProcessPretenuringFeedback(
     size_t new_space_capacity_target_capacity) {
   // The minimum new space capacity from which allocation sites can be
@@ -250,6 +380,7 @@ void PretenuringHandler::ProcessPretenuringFeedback(
       active_allocation_sites++;
       allocation_mementos_found += found_count;
       if (DigestPretenuringFeedback(heap_->isolate(), site,
+                                    &allocation_site_lifetimes_,
                                     new_space_was_above_pretenuring_threshold,
                                     new_space_capacity_target_capacity)) {
         trigger_deoptimization = true;
@@ -340,7 +471,10 @@ void PretenuringHandler::PretenureAllocationSiteOnNextCollection(
   allocation_sites_to_pretenure_->Push(site);
 }
 
-void PretenuringHandler::reset() { allocation_sites_to_pretenure_.reset(); }
+void PretenuringHandler::reset() {
+  allocation_sites_to_pretenure_.reset();
+  allocation_site_lifetimes_.clear();
+}
 
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_PRETENURING_HANDLER_H_
 #define V8_HEAP_PRETENURING_HANDLER_H_
 
+#include <array>
 #include <memory>
 #include <unordered_map>
 
@@ -19,6 +20,30 @@ namespace internal {
 template <typename T>
 class GlobalHandleVector;
 class Heap;
+class WeakObjectRetainer;
+
+// Survival history of an allocation site over several young generation GCs
+// (--allocation-site-lifetime-histogram). Each GC records the survival ratio of
+// the site into one of kBuckets buckets after decaying the existing samples by
+// --allocation-site-lifetime-decay.
+class AllocationSiteLifetime final {
+ public:
+  static constexpr int kBuckets = 10;
+
+  void AddSample(double survival_ratio, double weight = 1.0);
+
+  // Decayed number of recorded samples.
+  double samples() const;
+
+  // Decayed fraction of samples at or above `ratio`, interpolated within the
+  // bucket containing `ratio`.
+  double FractionAtOrAbove(double ratio) const;
+
+  double bucket(int index) const { return buckets_[index]; }
+
+ private:
+  std::array<double, kBuckets> buckets_{};
+};
 
 class PretenuringHandler final {
  public:
@@ -26,6 +51,9 @@ class PretenuringHandler final {
 
   using PretenuringFeedbackMap =
       std::unordered_map<Tagged<AllocationSite>, size_t, Object::Hasher>;
+  using AllocationSiteLifetimeMap =
+      std::unordered_map<Tagged<AllocationSite>, AllocationSiteLifetime,
+                         Object::Hasher>;
   enum FindMementoMode { kForRuntime, kForGC };
 
   explicit PretenuringHandler(Heap* heap);
@@ -92,6 +120,18 @@ class PretenuringHandler final {
     return !global_pretenuring_feedback_.empty();
   }
 
+  // Returns the lifetime histogram of `site` or nullptr if no survival ratio
+  // was recorded for it yet.
+  V8_EXPORT_PRIVATE const AllocationSiteLifetime* GetAllocationSiteLifetime(
+      Tagged<AllocationSite> site) const;
+
+  // Records that the objects of a tenured `site` died in the old generation,
+  // so that the site needs to survive consistently again to be re-tenured.
+  void RecordAllocationSiteTenuringReverted(Tagged<AllocationSite> site);
+
+  // Drops lifetime histograms of dead allocation sites and follows moved ones.
+  void UpdateAllocationSiteLifetimes(WeakObjectRetainer* retainer);
+
   V8_EXPORT_PRIVATE static int GetMinMementoCountForTesting();
 
  private:
@@ -106,6 +146,10 @@ class PretenuringHandler final {
 
   std::unique_ptr<GlobalHandleVector<AllocationSite>>
       allocation_sites_to_pretenure_;
+
+  // Lifetime histograms survive GCs. Keys are updated by
+  // UpdateAllocationSiteLifetimes() during full GCs.
+  AllocationSiteLifetimeMap allocation_site_lifetimes_;
 };
 
 }  // namespace internal
@@ -59,17 +59,106 @@ enum class PromoRecommendation {
 };
 using enum PromoRecommendation;
 
+// Collects the data that can be promoted from object graphs that the embedder
+// froze: the elements of frozen objects, and the heap numbers stored in them.
+// Frozen elements are never written to again. Freezing transitions Smi and
+// double elements to object elements, so these are always FixedArrays.
+class ImmutableDataCollector final : public ObjectVisitor {
+ public:
+  static HeapObjectSet Collect(
+      Isolate* isolate,
+      const std::vector<Tagged<JSReceiver>>& immutable_object_roots) {
+    ImmutableDataCollector collector(isolate);
+    for (Tagged<JSReceiver> root : immutable_object_roots) {
+      collector.Push(root);
+    }
+    while (!collector.worklist_.empty()) {
+      Tagged<HeapObject> o = collector.worklist_.back();
+      collector.worklist_.pop_back();
+      collector.Process(o);
+    }
+    return std::move(collector.data_);
+  }
+
+  void VisitPointers(Tagged<HeapObject> host, ObjectSlot start,
+                     ObjectSlot end) final {
+    VisitPointers(host, MaybeObjectSlot(start), MaybeObjectSlot(end));
+  }
+  void VisitPointers(Tagged<HeapObject> host, MaybeObjectSlot start,
+                     MaybeObjectSlot end) final {
+    for (MaybeObjectSlot slot = start; slot < end; slot++) {
+      Tagged<HeapObject> heap_object;
+      if (slot.load(isolate_).GetHeapObjectIfStrong(&heap_object)) {
+        Push(heap_object);
+      }
+    }
+  }
+  void VisitInstructionStreamPointer(Tagged<Code> host,
+                                     InstructionStreamSlot slot) final {}
+  // Maps are shared with mutable objects and never promoted along.
+  void VisitMapPointer(Tagged<HeapObject> host) final {}
+
+ private:
+  explicit ImmutableDataCollector(Isolate* isolate) : isolate_(isolate) {}
+
+  void Push(Tagged<HeapObject> o) {
+    if (HeapLayout::InReadOnlySpace(o)) return;
+    if (!visited_.insert(o).second) return;
+    worklist_.push_back(o);
+  }
+
+  void Process(Tagged<HeapObject> o) {
+    if (Tagged<JSObject> object; TryCast<JSObject>(o, &object)) {
+      // Functions and globals lead into the rest of the context and are not
+      // part of the embedder's data.
+      if (IsJSFunction(object) || IsJSGlobalObject(object) ||
+          IsJSGlobalProxy(object)) {
+        return;
+      }
+      Tagged<FixedArrayBase> elements = object->elements();
+      if (IsFrozenElementsKind(object->GetElementsKind()) &&
+          !HeapLayout::InReadOnlySpace(elements)) {
+        Tagged<FixedArray> array = Cast<FixedArray>(elements);
+        data_.insert(array);
+        for (int i = 0; i < array->length(); i++) {
+          Tagged<HeapNumber> number;
+          if (TryCast<HeapNumber>(array->get(i), &number) &&
+              !HeapLayout::InReadOnlySpace(number)) {
+            data_.insert(number);
+          }
+        }
+      }
+    } else if (!IsPropertyArray(o) && !IsNameDictionary(o) &&
+               !IsSwissNameDictionary(o) && !IsNumberDictionary(o) &&
+               !Contains(data_, o)) {
+      // Only follow the backing stores of objects.
+      return;
+    }
+    VisitObject(isolate_, o, this);
+  }
+
+  Isolate* const isolate_;
+  HeapObjectSet visited_;
+  HeapObjectList worklist_;
+  HeapObjectSet data_;
+};
+
 class Committee final {
  public:
   static HeapObjectList DeterminePromotees(
       Isolate* isolate, const DisallowGarbageCollection& no_gc,
-      const SafepointScope& safepoint_scope) {
-    return Committee(isolate).DeterminePromotees(safepoint_scope);
+      const SafepointScope& safepoint_scope,
+      const std::vector<Tagged<JSReceiver>>& immutable_object_roots) {
+    return Committee(isolate, ImmutableDataCollector::Collect(
+                                  isolate, immutable_object_roots))
+        .DeterminePromotees(safepoint_scope);
   }
 
  private:
-  explicit Committee(Isolate* isolate)
-      : isolate_(isolate), ref_encoder_(isolate) {}
+  Committee(Isolate* isolate, HeapObjectSet immutable_data)
+      : isolate_(isolate),
+        ref_encoder_(isolate),
+        immutable_data_(std::move(immutable_data)) {}
 
   const ExternalReferenceEncoder& ref_encoder() const { return ref_encoder_; }
 
@@ -212,6 +301,8 @@ class Committee final {
   V(ArrayList)                       \
   V(Code)                            \
   V(CodeWrapper)                     \
+  V(FixedArray)                      \
+  V(HeapNumber)                      \
   V(JSExternalObject)                \
   V(ObjectTemplateInfo)              \
   V(FunctionTemplateInfo)            \
@@ -268,6 +359,16 @@ class Committee final {
   }
   DEF_PROMO_CANDIDATE(FunctionTemplateRareData)
 
+  // Only data of frozen object graphs is known to stay immutable.
+  static PromoRecommendation GetPromoRecommendationFixedArray(
+      Committee* committee, Isolate* isolate, Tagged<FixedArray> o) {
+    return Contains(committee->immutable_data_, o) ? kPromote : kReject;
+  }
+  static PromoRecommendation GetPromoRecommendationHeapNumber(
+      Committee* committee, Isolate* isolate, Tagged<HeapNumber> o) {
+    return Contains(committee->immutable_data_, o) ? kPromote : kReject;
+  }
+
   static PromoRecommendation GetPromoRecommendationCode(Committee* committee,
                                                         Isolate* isolate,
                                                         Tagged<Code> o) {
@@ -446,6 +547,8 @@ class Committee final {
 
   Isolate* const isolate_;
   ExternalReferenceEncoder ref_encoder_;
+  // Objects that the embedder asked to promote.
+  const HeapObjectSet immutable_data_;
   HeapObjectSet promo_accepted_;
   HeapObjectSet promo_rejected_;
   HeapObjectSet promo_deferred_;
@@ -866,13 +969,14 @@ class ReadOnlyPromotionImpl final : public AllStatic {
 }  // namespace
 
 // static
-void ReadOnlyPromotion::Promote(Isolate* isolate,
-                                const SafepointScope& safepoint_scope,
-                                const DisallowGarbageCollection& no_gc) {
+void ReadOnlyPromotion::Promote(
+    Isolate* isolate, const SafepointScope& safepoint_scope,
+    const DisallowGarbageCollection& no_gc,
+    const std::vector<Tagged<JSReceiver>>& immutable_object_roots) {
   // Visit the mutable heap and determine the set of objects that can be
   // promoted to RO space.
-  std::vector<Tagged<HeapObject>> promotees =
-      Committee::DeterminePromotees(isolate, no_gc, safepoint_scope);
+  std::vector<Tagged<HeapObject>> promotees = Committee::DeterminePromotees(
+      isolate, no_gc, safepoint_scope, immutable_object_roots);
   // Physically copy promotee objects to RO space and track all object moves.
   HeapObjectMap moves;
   ReadOnlyPromotionImpl::CopyToReadOnlyHeap(isolate, promotees, &moves);
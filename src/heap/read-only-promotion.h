@@ -5,20 +5,28 @@
 #ifndef V8_HEAP_READ_ONLY_PROMOTION_H_
 #define V8_HEAP_READ_ONLY_PROMOTION_H_
 
+#include <vector>
+
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
+#include "src/objects/tagged.h"
 
 namespace v8 {
 namespace internal {
 
 class Isolate;
+class JSReceiver;
 class SafepointScope;
 
 class ReadOnlyPromotion final : public AllStatic {
  public:
-  V8_EXPORT_PRIVATE static void Promote(Isolate* isolate,
-                                        const SafepointScope& safepoint_scope,
-                                        const DisallowGarbageCollection& no_gc);
+  // `immutable_object_roots` are the roots of object graphs that the embedder
+  // froze for promotion (see
+  // v8::SnapshotCreator::FreezeAndPrepareForPromotionToReadOnly).
+  V8_EXPORT_PRIVATE static void Promote(
+      Isolate* isolate, const SafepointScope& safepoint_scope,
+      const DisallowGarbageCollection& no_gc,
+      const std::vector<Tagged<JSReceiver>>& immutable_object_roots);
 };
 
 }  // namespace internal
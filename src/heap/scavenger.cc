@@ -293,9 +293,22 @@ class Scavenger {
 
   using EmptyChunksList = ::heap::base::Worklist<MutablePage*, 64>;
 
+  // Large fixed arrays are split into slices of `kArraySliceSize` bytes that
+  // are processed independently, so that other tasks can steal them.
+  static constexpr int kArraySliceSize = 16 * KB;
+
+  struct ArraySliceEntry {
+    Tagged<FixedArray> array;
+    int start_offset;
+    int end_offset;
+    ObjectAge age;
+  };
+
+  using ArraySliceList = ::heap::base::Worklist<ArraySliceEntry, 64>;
+
   Scavenger(Heap* heap, bool is_logging, EmptyChunksList* empty_chunks,
             ScavengedObjectList* copied_list,
-            ScavengedObjectList* promoted_list,
+            ScavengedObjectList* promoted_list, ArraySliceList* array_slices,
             EphemeronRememberedSet::TableList* ephemeron_table_list,
             ScavengerWeakObjectsProcessor::JSWeakRefsList* js_weak_refs_list,
             ScavengerWeakObjectsProcessor::WeakCellsList* weak_cells_list,
@@ -322,6 +335,13 @@ class Scavenger {
   void PinAndPushObject(MutablePage* metadata, Tagged<HeapObject> object,
                         MapWord map_word);
 
+  // Returns true if the body of `array` should be processed in slices.
+  V8_INLINE static bool ShouldSplitArray(size_t array_size);
+
+  // Pushes slices covering the body of `array` and publishes them.
+  template <ObjectAge kAge>
+  void PushArraySlices(Tagged<FixedArray> array, size_t array_size);
+
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
 
@@ -441,6 +461,7 @@ class Scavenger {
   EmptyChunksList::Local local_empty_chunks_;
   ScavengedObjectList::Local local_copied_list_;
   ScavengedObjectList::Local local_promoted_list_;
+  ArraySliceList::Local local_array_slices_;
   EphemeronRememberedSet::TableList::Local local_ephemeron_table_list_;
   ScavengerWeakObjectsProcessor::JSWeakRefsList::Local local_js_weak_refs_list_;
   ScavengerWeakObjectsProcessor::WeakCellsList::Local local_weak_cells_list_;
@@ -563,6 +584,24 @@ class ScavengerObjectVisitorBase : public NewSpaceVisitor<ConcreteVisitor> {
     return Base::VisitWeakCell(map, object, maybe_size);
   }
 
+  V8_INLINE size_t VisitFixedArray(Tagged<Map> map, Tagged<FixedArray> object,
+                                   MaybeObjectSize maybe_object_size) {
+    const size_t size = maybe_object_size.AssumeSize();
+    if (V8_LIKELY(!Scavenger::ShouldSplitArray(size))) {
+      return Base::VisitFixedArray(map, object, maybe_object_size);
+    }
+    CheckObjectAge(object);
+    scavenger_->PushArraySlices<kExpectedObjectAge>(object, size);
+    return size;
+  }
+
+  // Visits the slots of a slice pushed by VisitFixedArray().
+  V8_INLINE void VisitArraySlice(const Scavenger::ArraySliceEntry& slice) {
+    DCHECK_EQ(kExpectedObjectAge, slice.age);
+    VisitPointersImpl(slice.array, slice.array->RawField(slice.start_offset),
+                      slice.array->RawField(slice.end_offset));
+  }
+
   V8_INLINE static constexpr bool CanEncounterFillerOrFreeSpace() {
     return false;
   }
@@ -706,6 +745,7 @@ class ScavengerJobTask : public v8::JobTask {
       std::vector<std::pair<ParallelWorkItem, MutablePage*>> old_to_new_chunks,
       const Scavenger::ScavengedObjectList& copied_list,
       const Scavenger::ScavengedObjectList& promoted_list,
+      const Scavenger::ArraySliceList& array_slices,
       std::atomic<size_t>& estimate_concurrency);
 
   void Run(JobDelegate* delegate) override;
@@ -726,6 +766,7 @@ class ScavengerJobTask : public v8::JobTask {
 
   const Scavenger::ScavengedObjectList& copied_list_;
   const Scavenger::ScavengedObjectList& promoted_list_;
+  const Scavenger::ArraySliceList& array_slices_;
 
   const uint64_t trace_id_;
   std::atomic<size_t>& estimate_concurrency_;
@@ -736,6 +777,7 @@ ScavengerJobTask::ScavengerJobTask(
     std::vector<std::pair<ParallelWorkItem, MutablePage*>> old_to_new_chunks,
     const Scavenger::ScavengedObjectList& copied_list,
     const Scavenger::ScavengedObjectList& promoted_list,
+    const Scavenger::ArraySliceList& array_slices,
     std::atomic<size_t>& estimate_concurrency)
     : heap_(heap),
       scavengers_(scavengers),
@@ -744,6 +786,7 @@ ScavengerJobTask::ScavengerJobTask(
       generator_(old_to_new_chunks_.size()),
       copied_list_(copied_list),
       promoted_list_(promoted_list),
+      array_slices_(array_slices),
       trace_id_(reinterpret_cast<uint64_t>(this) ^
                 heap_->tracer()->CurrentEpoch()),
       estimate_concurrency_(estimate_concurrency) {}
@@ -774,10 +817,11 @@ void ScavengerJobTask::Run(JobDelegate* delegate) {
 
 size_t ScavengerJobTask::GetMaxConcurrency(size_t worker_count) const {
   // We need to account for local segments held by worker_count in addition to
-  // GlobalPoolSize() of copied_list_, pinned_list_ and promoted_list_.
+  // GlobalPoolSize() of copied_list_, promoted_list_ and array_slices_.
   size_t wanted_num_workers = std::max<size_t>(
       remaining_memory_chunks_.load(std::memory_order_relaxed),
-      worker_count + copied_list_.Size() + promoted_list_.Size());
+      worker_count + copied_list_.Size() + promoted_list_.Size() +
+          array_slices_.Size());
   if (!heap_->ShouldUseBackgroundThreads() ||
       heap_->ShouldOptimizeForBattery()) {
     return std::min<size_t>(wanted_num_workers, 1);
@@ -1575,13 +1619,12 @@ void SweepArrayBufferExtensions(Heap* heap) {
 }
 
 int NumberOfScavengeTasks(Heap* heap) {
-  // The maximum number of scavenger tasks including the main thread. The actual
-  // number of tasks is determined at runtime.
-  static constexpr int kMaxScavengerTasks = 8;
-
   if (!v8_flags.parallel_scavenge) {
     return 1;
   }
+  // The maximum number of scavenger tasks including the main thread. The actual
+  // number of tasks is determined at runtime.
+  const int max_scavenger_tasks = std::max(1, v8_flags.scavenger_max_tasks);
   const int num_scavenge_tasks =
       static_cast<int>(
           SemiSpaceNewSpace::From(heap->new_space())->TotalCapacity()) /
@@ -1589,7 +1632,7 @@ int NumberOfScavengeTasks(Heap* heap) {
       1;
   static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
   int tasks = std::max(
-      1, std::min({num_scavenge_tasks, kMaxScavengerTasks, num_cores}));
+      1, std::min({num_scavenge_tasks, max_scavenger_tasks, num_cores}));
   if (!heap->CanPromoteYoungAndExpandOldGeneration(
           static_cast<size_t>(tasks * NormalPage::kPageSize))) {
     // Optimize for memory usage near the heap limit.
@@ -1642,6 +1685,7 @@ void ScavengerCollector::CollectGarbage() {
   Scavenger::EmptyChunksList empty_chunks;
   Scavenger::ScavengedObjectList copied_list;
   Scavenger::ScavengedObjectList promoted_list;
+  Scavenger::ArraySliceList array_slices;
   EphemeronRememberedSet::TableList ephemeron_table_list;
   ScavengerWeakObjectsProcessor::JSWeakRefsList js_weak_refs_list;
   ScavengerWeakObjectsProcessor::WeakCellsList weak_cells_list;
@@ -1666,8 +1710,8 @@ void ScavengerCollector::CollectGarbage() {
   // its own scavenger to avoid conflicts.
   Scavenger main_thread_scavenger(
       heap_, is_logging, &empty_chunks, &copied_list, &promoted_list,
-      &ephemeron_table_list, &js_weak_refs_list, &weak_cells_list,
-      should_handle_weak_objects_weakly);
+      &array_slices, &ephemeron_table_list, &js_weak_refs_list,
+      &weak_cells_list, should_handle_weak_objects_weakly);
 
   // Create scavengers for the parallel job (background threads + joining
   // thread).
@@ -1676,8 +1720,8 @@ void ScavengerCollector::CollectGarbage() {
   for (int i = 0; i < num_scavenge_tasks; ++i) {
     scavengers.emplace_back(std::make_unique<Scavenger>(
         heap_, is_logging, &empty_chunks, &copied_list, &promoted_list,
-        &ephemeron_table_list, &js_weak_refs_list, &weak_cells_list,
-        should_handle_weak_objects_weakly));
+        &array_slices, &ephemeron_table_list, &js_weak_refs_list,
+        &weak_cells_list, should_handle_weak_objects_weakly));
   }
 
   {
@@ -1729,7 +1773,7 @@ void ScavengerCollector::CollectGarbage() {
     std::atomic<size_t> estimate_concurrency{0};
     auto job = std::make_unique<ScavengerJobTask>(
         heap_, &scavengers, std::move(old_to_new_chunks), copied_list,
-        promoted_list, estimate_concurrency);
+        promoted_list, array_slices, estimate_concurrency);
     TRACE_GC_NOTE_WITH_FLOW("Parallel scavenge started",
                             perfetto::Flow::ProcessScoped(job->trace_id()));
     std::unique_ptr<JobHandle> job_handle = V8::GetCurrentPlatform()->PostJob(
@@ -1771,6 +1815,7 @@ void ScavengerCollector::CollectGarbage() {
     job_handle->Join();
     DCHECK(copied_list.IsEmpty());
     DCHECK(promoted_list.IsEmpty());
+    DCHECK(array_slices.IsEmpty());
 
     size_t estimated_concurrency =
         estimate_concurrency.load(std::memory_order_relaxed);
@@ -1900,6 +1945,7 @@ void ScavengerCollector::CompleteSweepingQuarantinedPagesIfNeeded() {
 Scavenger::Scavenger(
     Heap* heap, bool is_logging, EmptyChunksList* empty_chunks,
     ScavengedObjectList* copied_list, ScavengedObjectList* promoted_list,
+    ArraySliceList* array_slices,
     EphemeronRememberedSet::TableList* ephemeron_table_list,
     ScavengerWeakObjectsProcessor::JSWeakRefsList* js_weak_refs_list,
     ScavengerWeakObjectsProcessor::WeakCellsList* weak_cells_list,
@@ -1908,6 +1954,7 @@ Scavenger::Scavenger(
       local_empty_chunks_(*empty_chunks),
       local_copied_list_(*copied_list),
       local_promoted_list_(*promoted_list),
+      local_array_slices_(*array_slices),
       local_ephemeron_table_list_(*ephemeron_table_list),
       local_js_weak_refs_list_(*js_weak_refs_list),
       local_weak_cells_list_(*weak_cells_list),
@@ -1926,6 +1973,25 @@ Scavenger::Scavenger(
   }
 }
 
+// static
+bool Scavenger::ShouldSplitArray(size_t array_size) {
+  return v8_flags.scavenger_split_large_arrays &&
+         array_size > 2 * static_cast<size_t>(kArraySliceSize);
+}
+
+template <ObjectAge kAge>
+void Scavenger::PushArraySlices(Tagged<FixedArray> array, size_t array_size) {
+  DCHECK(ShouldSplitArray(array_size));
+  const int size = static_cast<int>(array_size);
+  for (int start = FixedArray::BodyDescriptor::kStartOffset; start < size;
+       start += kArraySliceSize) {
+    local_array_slices_.Push(
+        {array, start, std::min(size, start + kArraySliceSize), kAge});
+  }
+  // Slices are published right away so that idle tasks can steal them.
+  local_array_slices_.Publish();
+}
+
 bool Scavenger::ShouldEagerlyProcessPromotedList() const {
   // Threshold when to prioritize processing of the promoted list. Right
   // now we only look into the regular object list.
@@ -2537,6 +2603,16 @@ void Scavenger::Process(JobDelegate* delegate) {
   ScavengerCopiedObjectVisitor copied_object_visitor(this);
   ScavengerPromotedObjectVisitor promoted_object_visitor(this);
 
+  // Local work is shared when other tasks have run out of global work, e.g.,
+  // when a large object graph hangs off a single root.
+  auto share_work_if_needed =
+      [delegate](ScavengedObjectList::Local& local_list) {
+        if (local_list.ShareWorkIfGlobalEmpty() ||
+            !local_list.IsGlobalEmpty()) {
+          delegate->NotifyConcurrencyIncrease();
+        }
+      };
+
   bool done;
   size_t objects = 0;
   do {
@@ -2547,9 +2623,7 @@ void Scavenger::Process(JobDelegate* delegate) {
       copied_object_visitor.Visit(entry.map, entry.heap_object, entry.size);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
-        if (!local_copied_list_.IsGlobalEmpty()) {
-          delegate->NotifyConcurrencyIncrease();
-        }
+        share_work_if_needed(local_copied_list_);
       }
     }
 
@@ -2557,9 +2631,20 @@ void Scavenger::Process(JobDelegate* delegate) {
       promoted_object_visitor.Visit(entry.map, entry.heap_object, entry.size);
       done = false;
       if (delegate && ((++objects % kInterruptThreshold) == 0)) {
-        if (!local_promoted_list_.IsGlobalEmpty()) {
-          delegate->NotifyConcurrencyIncrease();
-        }
+        share_work_if_needed(local_promoted_list_);
+      }
+    }
+
+    ArraySliceEntry slice;
+    while (local_array_slices_.Pop(&slice)) {
+      if (slice.age == ObjectAge::kYoung) {
+        copied_object_visitor.VisitArraySlice(slice);
+      } else {
+        promoted_object_visitor.VisitArraySlice(slice);
+      }
+      done = false;
+      if (delegate && !local_array_slices_.IsGlobalEmpty()) {
+        delegate->NotifyConcurrencyIncrease();
       }
     }
   } while (!done);
@@ -2599,6 +2684,7 @@ void Scavenger::Finalize(
 void Scavenger::Publish() {
   local_copied_list_.Publish();
   local_promoted_list_.Publish();
+  local_array_slices_.Publish();
 }
 
 void Scavenger::AddEphemeronHashTable(Tagged<EphemeronHashTable> table) {
@@ -134,6 +134,8 @@ class Sweeper::MajorSweeperJob final : public JobTask {
   // Major sweeping jobs don't sweep new space.
   static constexpr int kNumberOfMajorSweepingSpaces =
       kNumberOfSweepingSpaces - 1;
+  // Number of dead large pages unmapped between yield checks.
+  static constexpr size_t kLargePagesPerStep = 4;
 
  public:
   static constexpr int kMaxTasks = kNumberOfMajorSweepingSpaces;
@@ -202,6 +204,12 @@ class Sweeper::MajorSweeperJob final : public JobTask {
         return;
       }
     }
+    // Unmap dead large pages only after regular pages were swept, since the
+    // mutator may be waiting on the latter for allocation.
+    MemoryAllocator* allocator = sweeper_->heap_->memory_allocator();
+    while (!delegate->ShouldYield()) {
+      if (allocator->ReleaseQueuedLargePages(kLargePagesPerStep) == 0) break;
+    }
   }
 
   Sweeper* const sweeper_;
@@ -365,6 +373,11 @@ void Sweeper::SweepingState<scope>::JoinSweeping() {
   if (HasValidJob()) job_handle_->Join();
 }
 
+template <Sweeper::SweepingScope scope>
+void Sweeper::SweepingState<scope>::NotifyConcurrencyIncrease() {
+  if (HasValidJob()) job_handle_->NotifyConcurrencyIncrease();
+}
+
 template <Sweeper::SweepingScope scope>
 void Sweeper::SweepingState<scope>::FinishSweeping() {
   DCHECK(in_progress_);
@@ -797,6 +810,12 @@ void Sweeper::StartMajorSweeperTasks() {
   major_sweeping_state_.StartConcurrentSweeping();
 }
 
+void Sweeper::NotifyLargePagesQueuedForRelease() {
+  if (!major_sweeping_in_progress()) return;
+  if (heap_->memory_allocator()->QueuedLargePagesCount() == 0) return;
+  major_sweeping_state_.NotifyConcurrencyIncrease();
+}
+
 namespace {
 
 void ZapDeadObjectsOnPage(Heap* heap, NormalPage* p) {
@@ -901,6 +920,8 @@ void Sweeper::FinishMajorJobs() {
   major_sweeping_state_.JoinSweeping();
   // All jobs are done but we still remain in sweeping state here.
   DCHECK(major_sweeping_in_progress());
+  // Without concurrent sweeping large pages are released lazily here.
+  heap_->memory_allocator()->ReleaseQueuedLargePages();
 
   ForAllSweepingSpaces([this](AllocationSpace space) {
     if (space == NEW_SPACE) return;
@@ -1309,7 +1330,7 @@ size_t Sweeper::ConcurrentMinorSweepingPageCount() {
 size_t Sweeper::ConcurrentMajorSweepingPageCount() {
   DCHECK(major_sweeping_in_progress());
   base::MutexGuard guard(&mutex_);
-  size_t count = 0;
+  size_t count = heap_->memory_allocator()->QueuedLargePagesCount();
   for (int i = 0; i < kNumberOfSweepingSpaces; i++) {
     if (i == GetSweepSpaceIndex(NEW_SPACE)) continue;
     count += sweeping_list_[i].size();
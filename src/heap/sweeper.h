@@ -143,6 +143,9 @@ class Sweeper {
   void InitializeMinorSweeping();
   V8_EXPORT_PRIVATE void StartMajorSweeperTasks();
   V8_EXPORT_PRIVATE void StartMinorSweeperTasks();
+  // Lets an already running major sweeper job pick up dead large pages that
+  // were queued for release after it was started.
+  void NotifyLargePagesQueuedForRelease();
 
   // Finishes all major sweeping tasks/work without changing the sweeping state.
   void FinishMajorJobs();
@@ -157,9 +160,9 @@ class Sweeper {
   void EnsureMinorCompleted();
 
   bool AreMinorSweeperTasksRunning() const;
-  bool AreMajorSweeperTasksRunning() const;
+  V8_EXPORT_PRIVATE bool AreMajorSweeperTasksRunning() const;
 
-  bool UsingMajorSweeperTasks() const;
+  V8_EXPORT_PRIVATE bool UsingMajorSweeperTasks() const;
 
   NormalPage* GetSweptPageSafe(PagedSpaceBase* space);
   SweptList GetAllSweptPagesSafe(PagedSpaceBase* space);
@@ -290,6 +293,7 @@ class Sweeper {
     void StopConcurrentSweeping();
     void FinishSweeping();
     void JoinSweeping();
+    void NotifyConcurrencyIncrease();
 
     bool HasValidJob() const;
     bool HasActiveJob() const;
@@ -4,9 +4,13 @@
 
 #include "src/init/isolate-group.h"
 
+#include <cstring>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/once.h"
 #include "src/base/platform/memory.h"
 #include "src/base/platform/mutex.h"
@@ -20,6 +24,8 @@
 #include "src/heap/safepoint.h"
 #include "src/init/v8.h"
 #include "src/sandbox/sandbox.h"
+#include "src/snapshot/snapshot-data.h"
+#include "src/snapshot/snapshot-utils.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
@@ -115,6 +121,7 @@ struct PtrComprCageReservationParams
     page_initialization_mode =
         base::PageInitializationMode::kAllocatedPagesCanBeUninitialized;
     page_freeing_mode = base::PageFreeingMode::kMakeInaccessible;
+    use_huge_pages = v8_flags.huge_pages;
   }
 };
 #endif  // V8_COMPRESS_POINTERS
@@ -201,7 +208,8 @@ void IsolateGroup::Initialize(bool process_wide, Sandbox* sandbox) {
             v8_flags.memory_pool_share_memory_on_teardown,
         .trace_gc_nvp = v8_flags.trace_gc_nvp,
         .max_large_page_pool_size = v8_flags.max_large_page_pool_size,
-        .timeout_in_sec = v8_flags.memory_pool_timeout});
+        .timeout_in_sec = v8_flags.memory_pool_timeout,
+        .max_prefaulted_pages = v8_flags.memory_pool_max_prefaulted_pages});
   }
 }
 #elif defined(V8_COMPRESS_POINTERS)
@@ -240,7 +248,8 @@ void IsolateGroup::Initialize(bool process_wide) {
       .share_memory_on_teardown = v8_flags.memory_pool_share_memory_on_teardown,
       .trace_gc_nvp = v8_flags.trace_gc_nvp,
       .max_large_page_pool_size = v8_flags.max_large_page_pool_size,
-      .timeout_in_sec = v8_flags.memory_pool_timeout});
+      .timeout_in_sec = v8_flags.memory_pool_timeout,
+      .max_prefaulted_pages = v8_flags.memory_pool_max_prefaulted_pages});
 }
 #else   // !V8_COMPRESS_POINTERS
 void IsolateGroup::Initialize(bool process_wide) {
@@ -253,7 +262,8 @@ void IsolateGroup::Initialize(bool process_wide) {
       .share_memory_on_teardown = v8_flags.memory_pool_share_memory_on_teardown,
       .trace_gc_nvp = v8_flags.trace_gc_nvp,
       .max_large_page_pool_size = v8_flags.max_large_page_pool_size,
-      .timeout_in_sec = v8_flags.memory_pool_timeout});
+      .timeout_in_sec = v8_flags.memory_pool_timeout,
+      .max_prefaulted_pages = v8_flags.memory_pool_max_prefaulted_pages});
 }
 #endif  // V8_ENABLE_SANDBOX
 
@@ -325,6 +335,106 @@ CodeRange* IsolateGroup::EnsureCodeRange(size_t requested_size) {
   return code_range_.get();
 }
 
+#if V8_OS_LINUX
+namespace {
+
+// Isolate groups that deserialize the same read-only snapshot end up with
+// mostly identical read-only pages, since the pages sit at the same offsets in
+// their cages. The first group copies its pages into a shared memory object
+// per snapshot. Every group then maps that object privately over those of its
+// pages whose contents match, so that the OS backs them with the same physical
+// memory. Private mappings keep groups isolated: writing to a page (e.g. when
+// it is freed and reused) only copies it. The shared memory objects live until
+// the process exits.
+class SharedReadOnlyPageRegistry final {
+ public:
+  // Returns the number of bytes of `pages` that are now shared.
+  size_t Share(uint32_t snapshot_checksum,
+               const std::vector<ReadOnlyPage*>& pages);
+
+ private:
+  struct Entry {
+    SharedMemoryHandle handle;
+    std::vector<size_t> page_sizes;
+  };
+
+  base::Mutex mutex_;
+  std::unordered_map<uint32_t, Entry> entries_;
+};
+
+size_t SharedReadOnlyPageRegistry::Share(
+    uint32_t snapshot_checksum, const std::vector<ReadOnlyPage*>& pages) {
+  const size_t os_page_size = base::OS::CommitPageSize();
+  std::vector<size_t> page_sizes;
+  size_t total_size = 0;
+  for (ReadOnlyPage* page : pages) {
+    page_sizes.push_back(RoundUp(page->size(), os_page_size));
+    total_size += page_sizes.back();
+  }
+
+  base::MutexGuard guard(&mutex_);
+  auto it = entries_.find(snapshot_checksum);
+  if (it == entries_.end()) {
+    std::optional<SharedMemoryHandle> handle =
+        base::OS::CreateSharedMemoryHandle(total_size, "v8-read-only-space");
+    if (!handle) return 0;
+    uint64_t offset = 0;
+    for (size_t i = 0; i < pages.size(); i++) {
+      if (!base::OS::WriteSharedMemory(
+              *handle, offset,
+              reinterpret_cast<const void*>(pages[i]->ChunkAddress()),
+              page_sizes[i])) {
+        base::OS::DestroySharedMemoryHandle(*handle);
+        return 0;
+      }
+      offset += page_sizes[i];
+    }
+    it = entries_.emplace(snapshot_checksum, Entry{*handle, page_sizes}).first;
+  } else if (it->second.page_sizes != page_sizes) {
+    // Differently laid out read-only spaces are not worth matching up.
+    return 0;
+  }
+
+  const SharedMemoryHandle handle = it->second.handle;
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[os_page_size]);
+  size_t shared_bytes = 0;
+  uint64_t page_offset = 0;
+  for (size_t i = 0; i < pages.size(); i++) {
+    const Address chunk = pages[i]->ChunkAddress();
+    // Map runs of matching OS pages at once.
+    size_t run_start = 0;
+    size_t run_size = 0;
+    auto map_run = [&]() {
+      if (run_size == 0) return;
+      CHECK(base::OS::MapSharedMemoryPrivately(
+          reinterpret_cast<void*>(chunk + run_start), run_size, handle,
+          page_offset + run_start, base::OS::MemoryPermission::kRead));
+      shared_bytes += run_size;
+      run_size = 0;
+    };
+    for (size_t offset = 0; offset < page_sizes[i]; offset += os_page_size) {
+      if (base::OS::ReadSharedMemory(handle, page_offset + offset,
+                                     buffer.get(), os_page_size) &&
+          memcmp(buffer.get(), reinterpret_cast<void*>(chunk + offset),
+                 os_page_size) == 0) {
+        if (run_size == 0) run_start = offset;
+        run_size += os_page_size;
+      } else {
+        map_run();
+      }
+    }
+    map_run();
+    page_offset += page_sizes[i];
+  }
+  return shared_bytes;
+}
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(SharedReadOnlyPageRegistry,
+                                GetSharedReadOnlyPageRegistry)
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
 ReadOnlyArtifacts* IsolateGroup::InitializeReadOnlyArtifacts() {
   mutex_.AssertHeld();
   DCHECK(!read_only_artifacts_);
@@ -343,7 +453,20 @@ void IsolateGroup::SetupReadOnlyHeap(Isolate* isolate,
                                      bool can_rehash) {
   DCHECK_EQ(isolate->isolate_group(), this);
   base::MutexGuard guard(&mutex_);
+  const bool read_only_heap_created = !read_only_artifacts_;
   ReadOnlyHeap::SetUp(isolate, read_only_snapshot_data, can_rehash);
+#if V8_OS_LINUX
+  // Only sealed read-only spaces have pages in the artifacts.
+  if (v8_flags.share_read_only_pages_across_isolate_groups &&
+      read_only_heap_created && read_only_snapshot_data != nullptr &&
+      !read_only_artifacts_->pages().empty()) {
+    shared_read_only_page_bytes_ = GetSharedReadOnlyPageRegistry()->Share(
+        Checksum(read_only_snapshot_data->Payload()),
+        read_only_artifacts_->pages());
+  }
+#else
+  USE(read_only_heap_created);
+#endif  // V8_OS_LINUX
 }
 
 void IsolateGroup::AddIsolate(Isolate* isolate) {
@@ -378,6 +501,7 @@ void IsolateGroup::RemoveIsolate(Isolate* isolate) {
 
   if (isolates_.size() == 1) {
     read_only_artifacts_.reset();
+    shared_read_only_page_bytes_ = 0;
 
     optimizing_compile_task_executor_->Stop();
 
@@ -208,6 +208,13 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
 
   ReadOnlyArtifacts* InitializeReadOnlyArtifacts();
 
+  // Bytes of the read-only space that are backed by the same physical memory
+  // as the read-only space of other isolate groups
+  // (--share-read-only-pages-across-isolate-groups).
+  size_t shared_read_only_page_bytes() const {
+    return shared_read_only_page_bytes_;
+  }
+
 #ifdef V8_ENABLE_SANDBOX
   // Unlike page_allocator() this one is supposed to be used for allocation
   // of memory for array backing stores or Wasm memory. When pointer compression
@@ -325,6 +332,7 @@ class V8_EXPORT_PRIVATE IsolateGroup final {
   // is also used to ensure that ReadOnlyArtifacts creation is only done once.
   base::Mutex mutex_;
   std::unique_ptr<ReadOnlyArtifacts> read_only_artifacts_;
+  size_t shared_read_only_page_bytes_ = 0;
   ReadOnlyHeap* shared_read_only_heap_ = nullptr;
   Isolate* shared_space_isolate_ = nullptr;
   // Used to track and safepoint all isolates in this isolate group.
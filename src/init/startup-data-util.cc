@@ -7,6 +7,8 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <limits>
+
 #include "include/v8-initialization.h"
 #include "include/v8-snapshot.h"
 #include "src/base/file-utils.h"
@@ -24,6 +26,8 @@ namespace internal {
 namespace {
 
 v8::StartupData g_snapshot;
+// Set if the blob in g_snapshot is backed by a read-only file mapping.
+base::OS::MemoryMappedFile* g_mapped_snapshot = nullptr;
 
 void ClearStartupData(v8::StartupData* data) {
   data->data = nullptr;
@@ -31,7 +35,12 @@ void ClearStartupData(v8::StartupData* data) {
 }
 
 void DeleteStartupData(v8::StartupData* data) {
-  delete[] data->data;
+  if (g_mapped_snapshot) {
+    delete g_mapped_snapshot;
+    g_mapped_snapshot = nullptr;
+  } else {
+    delete[] data->data;
+  }
   ClearStartupData(data);
 }
 
@@ -39,12 +48,35 @@ void FreeStartupData() {
   DeleteStartupData(&g_snapshot);
 }
 
+// Maps the blob privately and read-only. The blob is never written to, so all
+// its pages stay clean and are shared through the page cache with every other
+// process that maps the same file.
+bool Map(const char* blob_file, v8::StartupData* startup_data) {
+  base::OS::MemoryMappedFile* file = base::OS::MemoryMappedFile::open(
+      blob_file, base::OS::MemoryMappedFile::FileMode::kReadOnly);
+  if (!file) return false;
+  if (file->size() == 0 ||
+      file->size() > static_cast<size_t>(std::numeric_limits<int>::max())) {
+    delete file;
+    return false;
+  }
+  g_mapped_snapshot = file;
+  startup_data->data = static_cast<const char*>(file->memory());
+  startup_data->raw_size = static_cast<int>(file->size());
+  return true;
+}
+
 void Load(const char* blob_file, v8::StartupData* startup_data,
           void (*setter_fn)(v8::StartupData*)) {
   ClearStartupData(startup_data);
 
   CHECK(blob_file);
 
+  if (v8_flags.map_snapshot_blob && Map(blob_file, startup_data)) {
+    (*setter_fn)(startup_data);
+    return;
+  }
+
   FILE* file = base::Fopen(blob_file, "rb");
   if (!file) {
     PrintF(stderr, "Failed to open startup resource '%s'.\n", blob_file);
@@ -90,5 +122,13 @@ void InitializeExternalStartupDataFromFile(const char* snapshot_blob) {
 #endif  // V8_USE_EXTERNAL_STARTUP_DATA
 }
 
+bool IsExternalStartupDataMapped() {
+#ifdef V8_USE_EXTERNAL_STARTUP_DATA
+  return g_mapped_snapshot != nullptr;
+#else
+  return false;
+#endif  // V8_USE_EXTERNAL_STARTUP_DATA
+}
+
 }  // namespace internal
 }  // namespace v8
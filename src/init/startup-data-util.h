@@ -5,6 +5,8 @@
 #ifndef V8_INIT_STARTUP_DATA_UTIL_H_
 #define V8_INIT_STARTUP_DATA_UTIL_H_
 
+#include "src/base/macros.h"
+
 namespace v8 {
 namespace internal {
 
@@ -18,6 +20,10 @@ namespace internal {
 void InitializeExternalStartupData(const char* directory_path);
 void InitializeExternalStartupDataFromFile(const char* snapshot_blob);
 
+// Returns whether the loaded external startup data is backed by a file
+// mapping rather than a heap copy.
+V8_EXPORT_PRIVATE bool IsExternalStartupDataMapped();
+
 }  // namespace internal
 }  // namespace v8
 
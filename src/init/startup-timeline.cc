@@ -0,0 +1,51 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/init/startup-timeline.h"
+
+#include "src/execution/isolate.h"
+#include "src/tracing/trace-event.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+const char* StartupTimeline::PhaseName(Phase phase) {
+  switch (phase) {
+#define CASE(Name, TraceName) \
+  case Phase::k##Name:        \
+    return TraceName;
+    STARTUP_PHASE_LIST(CASE)
+#undef CASE
+  }
+  UNREACHABLE();
+}
+
+bool StartupTimeline::Contains(Phase phase) const {
+  for (size_t i = 0; i < event_count_; i++) {
+    if (events_[i].phase == phase) return true;
+  }
+  return false;
+}
+
+void StartupTimeline::Record(Phase phase, base::TimeTicks start,
+                             base::TimeTicks end) {
+  if (event_count_ == kMaxEvents) return;
+  events_[event_count_++] = {phase, start - origin_, end - start};
+}
+
+StartupTimeline::Scope::Scope(Isolate* isolate, Phase phase)
+    : timeline_(isolate->startup_timeline()),
+      phase_(phase),
+      start_(base::TimeTicks::Now()) {
+  TRACE_EVENT_BEGIN("v8", perfetto::StaticString(PhaseName(phase)));
+}
+
+StartupTimeline::Scope::~Scope() {
+  TRACE_EVENT_END("v8");
+  timeline_->Record(phase_, start_, base::TimeTicks::Now());
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,92 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_INIT_STARTUP_TIMELINE_H_
+#define V8_INIT_STARTUP_TIMELINE_H_
+
+#include <array>
+#include <cstddef>
+
+#include "src/base/macros.h"
+#include "src/base/platform/time.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+
+#define STARTUP_PHASE_LIST(V)                                     \
+  V(EmbeddedBlobSetup, "V8.StartupEmbeddedBlobSetup")             \
+  V(ReadOnlyHeapSetup, "V8.StartupReadOnlyHeapSetup")             \
+  V(StartupDeserialization, "V8.StartupDeserialization")          \
+  V(ContextDeserialization, "V8.StartupContextDeserialization")   \
+  V(EmbedderFieldCallbacks, "V8.StartupEmbedderFieldCallbacks")   \
+  V(FirstScriptCompile, "V8.StartupFirstScriptCompile")
+
+// Records when the phases of creating an isolate and its contexts happened,
+// relative to the allocation of the isolate. Each phase is also emitted as a
+// trace event of the same name. Only the first kMaxEvents phases are kept, so
+// that isolates creating many contexts do not grow the timeline unboundedly.
+class StartupTimeline final {
+ public:
+  enum class Phase {
+#define DEFINE_PHASE(Name, TraceName) k##Name,
+    STARTUP_PHASE_LIST(DEFINE_PHASE)
+#undef DEFINE_PHASE
+  };
+
+  struct Event {
+    Phase phase;
+    // Both relative to the allocation of the isolate.
+    base::TimeDelta start;
+    base::TimeDelta duration;
+  };
+
+  static constexpr size_t kMaxEvents = 32;
+
+  // Records the phase for the lifetime of the scope. Phases may nest, e.g.
+  // embedder field callbacks run during context deserialization.
+  class V8_NODISCARD Scope final {
+   public:
+    Scope(Isolate* isolate, Phase phase);
+    ~Scope();
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+   private:
+    StartupTimeline* const timeline_;
+    const Phase phase_;
+    const base::TimeTicks start_;
+  };
+
+  StartupTimeline() : origin_(base::TimeTicks::Now()) {}
+
+  StartupTimeline(const StartupTimeline&) = delete;
+  StartupTimeline& operator=(const StartupTimeline&) = delete;
+
+  static const char* PhaseName(Phase phase);
+
+  // Whether the phase was recorded at least once.
+  bool Contains(Phase phase) const;
+
+  // Events are ordered by the time their phase ended.
+  size_t event_count() const { return event_count_; }
+  const Event& event(size_t index) const {
+    DCHECK_LT(index, event_count_);
+    return events_[index];
+  }
+
+ private:
+  void Record(Phase phase, base::TimeTicks start, base::TimeTicks end);
+
+  const base::TimeTicks origin_;
+  std::array<Event, kMaxEvents> events_;
+  size_t event_count_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_INIT_STARTUP_TIMELINE_H_
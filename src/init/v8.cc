@@ -184,8 +184,9 @@ void V8::Initialize() {
 
   FlagList::EnforceFlagImplications();
 
-  // Initialize the default FlagList::Hash.
+  // Initialize the default FlagList::Hash and FlagList::CodeCacheHash.
   FlagList::Hash();
+  FlagList::CodeCacheHash();
 
   // Before initializing internals, freeze the flags such that further changes
   // are not allowed. Global initialization of the Isolate or the WasmEngine
@@ -359,6 +359,7 @@ namespace internal {
   SC(lo_space_bytes_available, V8.MemoryLoSpaceBytesAvailable)                 \
   SC(lo_space_bytes_committed, V8.MemoryLoSpaceBytesCommitted)                 \
   SC(lo_space_bytes_used, V8.MemoryLoSpaceBytesUsed)                           \
+  SC(huge_page_backed_bytes, V8.MemoryHugePageBackedBytes)                     \
   SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                      \
   SC(wasm_reloc_size, V8.WasmRelocBytes)                                       \
   SC(wasm_deopt_data_size, V8.WasmDeoptDataBytes)                              \
@@ -171,6 +171,7 @@ namespace v8::internal {
   V(Set_New)                                               \
   V(SharedArrayBuffer_New)                                 \
   V(SharedArrayBuffer_NewBackingStore)                     \
+  V(SnapshotCreator_FreezeForPromotion)                    \
   V(String_Concat)                                         \
   V(String_NewExternalOneByte)                             \
   V(String_NewExternalTwoByte)                             \
@@ -309,6 +310,7 @@ namespace v8::internal {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopOptimization)        \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopPeeling)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopUnrolling)           \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftLoopVectorization)       \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftMachineLowering)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftRandomRescheduling)      \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TurboshaftTurbolevGraphBuilding)   \
@@ -23,6 +23,7 @@
 #include "src/maglev/maglev-compilation-unit.h"
 #include "src/maglev/maglev-graph-builder.h"
 #include "src/maglev/maglev-graph-labeller.h"
+#include "src/maglev/maglev-graph-optimizer.h"
 #include "src/maglev/maglev-graph-printer.h"
 #include "src/maglev/maglev-graph-processor.h"
 #include "src/maglev/maglev-graph-serializer.h"
@@ -32,10 +33,12 @@
 #include "src/maglev/maglev-interpreter-frame-state.h"
 #include "src/maglev/maglev-ir-inl.h"
 #include "src/maglev/maglev-ir.h"
+#include "src/maglev/maglev-kna-processor.h"
 #include "src/maglev/maglev-phase.h"
 #include "src/maglev/maglev-phi-representation-selector.h"
 #include "src/maglev/maglev-post-hoc-optimizations-processors.h"
 #include "src/maglev/maglev-pre-regalloc-codegen-processors.h"
+#include "src/maglev/maglev-range-analysis.h"
 #include "src/maglev/maglev-regalloc.h"
 #include "src/maglev/maglev-truncation.h"
 #include "src/objects/code-inl.h"
@@ -82,6 +85,13 @@ void PrintAndVerify(Graph* graph, bool printing_condition, MaglevPhase phase) {
   PrintGraph(graph, printing_condition, phase);
   VerifyGraph(graph, phase);
 }
+
+bool HasLoops(Graph* graph) {
+  for (BasicBlock* block : graph->blocks()) {
+    if (block->is_loop()) return true;
+  }
+  return false;
+}
 }  // namespace
 
 // static
@@ -218,6 +228,32 @@ bool MaglevCompiler::Compile(LocalIsolate* local_isolate,
       PrintAndVerify(graph, v8_flags.print_maglev_graphs,
                      MaglevPhase::kPhiUntagging);
     }
+
+    if (v8_flags.maglev_bounds_check_elimination && HasLoops(graph)) {
+      TRACE_EVENT(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                  "V8.Maglev.BoundsCheckElimination");
+      SYNCHRONIZATION_POINT("MaglevBoundsCheckElimination");
+      // Bounds checks on induction variables are removed by the graph
+      // optimizer using the less-than constraints of the loop conditions.
+      NodeRanges ranges(graph);
+      ranges.ProcessGraph();
+      if (V8_UNLIKELY(v8_flags.trace_maglev_range_analysis)) {
+        ranges.Print();
+      }
+      ReachableExceptionHandlerTracker tracker(graph);
+      RecomputeKnownNodeAspectsProcessor kna_processor(graph, tracker);
+      MaglevGraphOptimizer optimizer(graph, kna_processor, &ranges);
+      GraphMultiProcessor<MaglevGraphOptimizer&,
+                          ReachableExceptionHandlerTracker&,
+                          RecomputeKnownNodeAspectsProcessor&>
+          processor(optimizer, tracker, kna_processor);
+      processor.ProcessGraph(graph);
+      if (graph->may_have_unreachable_blocks()) {
+        graph->RemoveUnreachableBlocks();
+      }
+      PrintAndVerify(graph, v8_flags.print_maglev_graphs,
+                     MaglevPhase::kRangeAnalysis);
+    }
   }
 
   {
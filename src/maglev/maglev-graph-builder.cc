@@ -4379,11 +4379,8 @@ ReduceResult MaglevGraphBuilder::BuildLoadJSFunctionFeedbackCell(
   if (auto constant = TryGetConstant<JSFunction>(closure)) {
     return GetConstant(constant->raw_feedback_cell(broker()));
   }
-  if (auto fast_closure = closure->TryCast<FastCreateClosure>()) {
-    return GetConstant(fast_closure->feedback_cell());
-  }
-  if (auto slow_closure = closure->TryCast<CreateClosure>()) {
-    return GetConstant(slow_closure->feedback_cell());
+  if (auto new_closure = TryGetNewClosure(closure)) {
+    return GetConstant(new_closure->feedback_cell);
   }
   // The feedback cell is only set when the JSFunction is allocated, or via
   // LiveEdit, but that doesn't concern optimized code, so treat it as const.
@@ -4397,11 +4394,8 @@ ReduceResult MaglevGraphBuilder::BuildLoadJSFunctionContext(
   if (auto constant = TryGetConstant<JSFunction>(closure)) {
     return GetConstant(constant->context(broker()));
   }
-  if (auto fast_closure = closure->TryCast<FastCreateClosure>()) {
-    return fast_closure->ContextInput().node();
-  }
-  if (auto slow_closure = closure->TryCast<CreateClosure>()) {
-    return slow_closure->ContextInput().node();
+  if (auto new_closure = TryGetNewClosure(closure)) {
+    return new_closure->context;
   }
   return BuildLoadTaggedField(closure, offsetof(JSFunction, context_),
                               NodeType::kContext);
@@ -9761,10 +9755,8 @@ MaybeReduceResult MaglevGraphBuilder::TryReduceArrayPrototypeSort(
   compiler::OptionalSharedFunctionInfoRef comparefn_shared;
   if (auto maybe_fn = TryGetConstant<JSFunction>(comparefn)) {
     comparefn_shared = maybe_fn->shared(broker());
-  } else if (auto* fcc = comparefn->TryCast<FastCreateClosure>()) {
-    comparefn_shared = fcc->shared_function_info();
-  } else if (auto* cc = comparefn->TryCast<CreateClosure>()) {
-    comparefn_shared = cc->shared_function_info();
+  } else if (auto new_closure = TryGetNewClosure(comparefn)) {
+    comparefn_shared = new_closure->shared;
   } else {
     MAGLEV_FAIL(
         " to reduce Array.prototype.sort - comparefn is not a statically-known"
@@ -12001,24 +11993,11 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
     RETURN_IF_DONE(result);
   }
 
-  // If the implementation here becomes more complex, we could probably
-  // deduplicate the code for FastCreateClosure and CreateClosure by using
-  // templates or giving them a shared base class.
-  if (FastCreateClosure* fast_create_closure =
-          target_node->TryCast<FastCreateClosure>()) {
-    MaybeReduceResult result = TryReduceCallForNewClosure(
-        fast_create_closure, fast_create_closure->ContextInput().node(),
-        fast_create_closure->feedback_cell().dispatch_handle(),
-        fast_create_closure->shared_function_info(),
-        fast_create_closure->feedback_cell(), args, feedback_source);
-    RETURN_IF_DONE(result);
-  } else if (CreateClosure* create_closure =
-                 target_node->TryCast<CreateClosure>()) {
+  if (auto new_closure = TryGetNewClosure(target_node)) {
     MaybeReduceResult result = TryReduceCallForNewClosure(
-        create_closure, create_closure->ContextInput().node(),
-        create_closure->feedback_cell().dispatch_handle(),
-        create_closure->shared_function_info(), create_closure->feedback_cell(),
-        args, feedback_source);
+        target_node, new_closure->context,
+        new_closure->feedback_cell.dispatch_handle(), new_closure->shared,
+        new_closure->feedback_cell, args, feedback_source);
     RETURN_IF_DONE(result);
   }
 
@@ -14310,6 +14289,9 @@ ReduceResult MaglevGraphBuilder::VisitCreateClosure() {
   uint32_t flags = GetFlag8Operand(2);
 
   if (interpreter::CreateClosureFlags::FastNewClosureBit::decode(flags)) {
+    PROCESS_AND_RETURN_IF_DONE(
+        TryBuildInlinedAllocatedClosure(shared_function_info, feedback_cell),
+        SetAccumulator);
     return SetAccumulator(AddNewNode<FastCreateClosure>(
         {GetContext()}, shared_function_info, feedback_cell));
   } else {
@@ -14320,6 +14302,70 @@ ReduceResult MaglevGraphBuilder::VisitCreateClosure() {
   }
 }
 
+std::optional<MaglevGraphBuilder::NewClosure>
+MaglevGraphBuilder::TryGetNewClosure(ValueNode* closure) {
+  if (auto fast_closure = closure->TryCast<FastCreateClosure>()) {
+    return NewClosure{fast_closure->ContextInput().node(),
+                      fast_closure->shared_function_info(),
+                      fast_closure->feedback_cell()};
+  }
+  if (auto slow_closure = closure->TryCast<CreateClosure>()) {
+    return NewClosure{slow_closure->ContextInput().node(),
+                      slow_closure->shared_function_info(),
+                      slow_closure->feedback_cell()};
+  }
+  if (auto allocation = closure->TryCast<InlinedAllocation>()) {
+    VirtualObject* vobj = allocation->object();
+    if (vobj->object_layout() != &VirtualJSFunctionShape::kObjectLayout &&
+        vobj->object_layout() !=
+            &VirtualJSFunctionWithPrototypeShape::kObjectLayout) {
+      return {};
+    }
+    // These fields are constant after initialization, see
+    // VirtualJSFunctionShape.
+    auto shared = TryGetConstant<SharedFunctionInfo>(
+        vobj->get(offsetof(JSFunction, shared_function_info_)));
+    auto feedback_cell = TryGetConstant<FeedbackCell>(
+        vobj->get(offsetof(JSFunction, feedback_cell_)));
+    DCHECK(shared.has_value() && feedback_cell.has_value());
+    return NewClosure{vobj->get(offsetof(JSFunction, context_)), shared.value(),
+                      feedback_cell.value()};
+  }
+  return {};
+}
+
+MaybeReduceResult MaglevGraphBuilder::TryBuildInlinedAllocatedClosure(
+    compiler::SharedFunctionInfoRef shared,
+    compiler::FeedbackCellRef feedback_cell) {
+  if (!v8_flags.maglev_inline_closure_allocation) return {};
+  // Turbolev's escape analysis doesn't know about virtual closures yet.
+  if (is_turbolev()) return {};
+  // Like Turbofan, only allocate closures inline for creation sites that have
+  // seen more than one closure. All of them share the dispatch handle of the
+  // feedback cell, which is thus constant.
+  if (!feedback_cell.map(broker()).equals(broker()->many_closures_cell_map())) {
+    return {};
+  }
+  if (IsClassConstructor(shared.kind())) return {};
+  // Closures of builtins use the builtin's dispatch handle instead.
+  if (shared.HasBuiltinId()) return {};
+  JSDispatchHandle dispatch_handle = feedback_cell.dispatch_handle();
+  if (dispatch_handle == kNullJSDispatchHandle) return {};
+  compiler::MapRef map =
+      broker()->target_native_context().GetFunctionMapFromIndex(
+          broker(), shared.function_map_index());
+  DCHECK(!map.IsInobjectSlackTrackingInProgress());
+  DCHECK(!map.is_dictionary_map());
+  if (map.GetInObjectProperties() != 0) return {};
+  VirtualObject* closure = reducer_.CreateJSFunction(
+      map, shared, feedback_cell, dispatch_handle, GetContext());
+  InlinedAllocation* allocation;
+  GET_VALUE_OR_ABORT(allocation, reducer_.BuildInlinedAllocation(
+                                     closure, AllocationType::kYoung));
+  reducer_.RecordTypeNoAbort(allocation, NodeType::kJSFunction);
+  return allocation;
+}
+
 MaybeReduceResult MaglevGraphBuilder::TryBuildInlinedAllocatedContext(
     compiler::MapRef map, int context_length, compiler::ScopeInfoRef scope,
     ValueNode* extension) {
@@ -1051,6 +1051,17 @@ class MaglevGraphBuilder {
   MaybeReduceResult TryReduceCallForTarget(
       ValueNode* target_node, compiler::JSFunctionRef target,
       CallArguments& args, const compiler::FeedbackSource& feedback_source);
+  // A closure created in this graph, either by a (Fast)CreateClosure node or
+  // by an inlined allocation.
+  struct NewClosure {
+    ValueNode* context;
+    compiler::SharedFunctionInfoRef shared;
+    compiler::FeedbackCellRef feedback_cell;
+  };
+  std::optional<NewClosure> TryGetNewClosure(ValueNode* closure);
+  MaybeReduceResult TryBuildInlinedAllocatedClosure(
+      compiler::SharedFunctionInfoRef shared,
+      compiler::FeedbackCellRef feedback_cell);
   MaybeReduceResult TryReduceCallForNewClosure(
       ValueNode* target_node, ValueNode* target_context,
       JSDispatchHandle dispatch_handle,
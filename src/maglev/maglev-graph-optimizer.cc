@@ -1000,7 +1000,17 @@ ProcessResult MaglevGraphOptimizer::VisitCheckJSDataViewBounds(
 
 ProcessResult MaglevGraphOptimizer::VisitCheckTypedArrayBounds(
     CheckTypedArrayBounds* node, const ProcessingState& state) {
-  // TODO(b/424157317): Optimize.
+  ValueNode* index = node->input_node(0);
+  ValueNode* length = node->input_node(1);
+  const auto r1 = GetRange(index);
+  const auto r2 = GetRange(length);
+  // The check compares the (zero extended) index unsigned, which is the same
+  // as a signed comparison as long as the index is known to be non-negative.
+  if (r1 && r2 && r1->IsUint32()) {
+    if (*r1 < *r2 || IsRangeLessEqual(index, length)) {
+      return RemoveCurrentNode();
+    }
+  }
   return ProcessResult::kContinue;
 }
 
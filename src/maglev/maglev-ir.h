@@ -6095,6 +6095,32 @@ struct VirtualJSIteratorResultShape : VirtualJSObjectShape {
 #undef FIELD_LIST
 };
 
+// Like Turbofan, we leave the padding after the dispatch handle (if any)
+// uninitialized and don't describe it to the deoptimizer, which iterates the
+// fields of captured objects in steps of kTaggedSize.
+struct VirtualJSFunctionShape : VirtualJSObjectShape {
+  using T = JSFunction;
+#define FIELD_LIST(V)                                                        \
+  V(dispatch_handle, offsetof(T, dispatch_handle_), vobj::FieldType::kInt32) \
+  V(shared_function_info, offsetof(T, shared_function_info_),                \
+    vobj::FieldType::kTagged, vobj::FieldConstness::kConstAfterInit)         \
+  V(context, offsetof(T, context_), vobj::FieldType::kTagged,                \
+    vobj::FieldConstness::kConstAfterInit)                                   \
+  V(feedback_cell, offsetof(T, feedback_cell_), vobj::FieldType::kTagged,    \
+    vobj::FieldConstness::kConstAfterInit)
+  DEF_SHAPE(VirtualJSObjectShape, FIELD_LIST);
+#undef FIELD_LIST
+};
+
+struct VirtualJSFunctionWithPrototypeShape : VirtualJSFunctionShape {
+  using T = JSFunctionWithPrototype;
+#define FIELD_LIST(V)                                                 \
+  V(prototype_or_initial_map, offsetof(T, prototype_or_initial_map_), \
+    vobj::FieldType::kTagged)
+  DEF_SHAPE(VirtualJSFunctionShape, FIELD_LIST);
+#undef FIELD_LIST
+};
+
 struct VirtualJSPrimitiveWrapperShape : VirtualJSObjectShape {
   using T = JSPrimitiveWrapper;
 #define FIELD_LIST(V) V(value, offsetof(T, value_), vobj::FieldType::kTagged)
@@ -235,10 +235,19 @@ class RecomputePhiUseHintsProcessor {
 
 // Optimizations involving loops which cannot be done at graph building time.
 // Currently mainly loop invariant code motion.
+//
+// Nodes are hoisted from the loop header and, if nothing in the header stopped
+// hoisting, from the first block of the loop body. Everything before a
+// hoisted node in these blocks was hoisted too or cannot deopt, so the hoisted
+// node still runs after the same checks. The body is only entered when the
+// loop condition holds though, and nodes in there might rely on facts learned
+// from that condition. Loads in the body are thus only hoisted if the map or
+// type check of their object was hoisted out of this loop by this processor;
+// loads relying on a check in front of the loop stay in the body.
 class LoopOptimizationProcessor {
  public:
   explicit LoopOptimizationProcessor(MaglevCompilationInfo* info)
-      : zone(info->zone()) {
+      : zone(info->zone()), checked_objects(info->zone()) {
     was_deoptimized =
         info->toplevel_compilation_unit()->feedback().was_once_deoptimized();
   }
@@ -247,25 +256,42 @@ class LoopOptimizationProcessor {
   void PostPhiProcessing() {}
 
   BlockProcessResult PostProcessBasicBlock(BasicBlock* block) {
+    if (block == loop_header && loop_effects) {
+      // The header was fully processed, continue with the loop body.
+      block->ForEachSuccessor([&](BasicBlock* succ) {
+        if (succ->predecessor_count() == 1 &&
+            succ->id() > block->id() &&
+            succ->id() <= block->backedge_predecessor()->id()) {
+          loop_body = succ;
+        }
+      });
+    }
     return BlockProcessResult::kContinue;
   }
   BlockProcessResult PreProcessBasicBlock(BasicBlock* block) {
     current_block = block;
     if (current_block->is_loop()) {
+      loop_header = current_block;
+      loop_body = nullptr;
+      checked_objects.clear();
       loop_effects = current_block->state()->AsLoopHeader()->loop_effects();
       if (loop_effects) return BlockProcessResult::kContinue;
+    } else if (current_block == loop_body && loop_effects) {
+      return BlockProcessResult::kContinue;
     } else {
       // TODO(olivf): Some dominance analysis would allow us to keep loop
-      // effects longer than just the first block of the loop.
+      // effects longer than just the first blocks of the loop.
       loop_effects = nullptr;
     }
     return BlockProcessResult::kSkip;
   }
 
+  bool in_loop_header() const { return current_block == loop_header; }
+
   bool IsLoopPhi(Node* input) {
-    DCHECK(current_block->is_loop());
+    DCHECK(loop_header->is_loop());
     if (auto phi = input->TryCast<Phi>()) {
-      if (phi->is_loop_phi() && phi->merge_state() == current_block->state()) {
+      if (phi->is_loop_phi() && phi->merge_state() == loop_header->state()) {
         return true;
       }
     }
@@ -274,7 +300,7 @@ class LoopOptimizationProcessor {
 
   bool CanHoist(Node* candidate) {
     DCHECK_EQ(candidate->input_count(), 1);
-    DCHECK(current_block->is_loop());
+    DCHECK(loop_header->is_loop());
     ValueNode* input = candidate->input(0).node();
     DCHECK(!IsLoopPhi(input));
     // For hoisting an instruction we need:
@@ -282,14 +308,25 @@ class LoopOptimizationProcessor {
     // * No hoisting over checks (done eagerly by clearing loop_effects).
     // A resumable loop is also entered through resume edges that bypass its
     // header, so it might not have a forward edge to hoist into at all.
-    if (current_block->state()->is_resumable_loop()) return false;
-    DCHECK_EQ(current_block->predecessor_count(), 2);
-    BasicBlock* loop_entry = current_block->forward_predecessor();
+    if (loop_header->state()->is_resumable_loop()) return false;
+    DCHECK_EQ(loop_header->predecessor_count(), 2);
+    BasicBlock* loop_entry = loop_header->forward_predecessor();
     if (loop_entry->successors().size() != 1) {
       return false;
     }
     if (IsConstantNode(input->opcode())) return true;
-    return input->owner() != current_block;
+    return input->owner() != loop_header && input->owner() != current_block;
+  }
+
+  ProcessResult Hoist(Node* node) {
+    if (in_loop_header()) return ProcessResult::kHoist;
+    // The graph processor only hoists into the unique predecessor, which for
+    // the loop body is the header. Move the node in front of the loop
+    // ourselves instead.
+    BasicBlock* loop_entry = loop_header->forward_predecessor();
+    node->set_owner(loop_entry);
+    loop_entry->nodes().push_back(node);
+    return ProcessResult::kRemove;
   }
 
   ProcessResult Process(LoadContextSlotNoCells* ltf,
@@ -303,14 +340,23 @@ class LoopOptimizationProcessor {
     if (!loop_effects->may_have_aliasing_contexts &&
         !loop_effects->unstable_aspects_cleared &&
         !loop_effects->context_slot_written.count(key) && CanHoist(ltf)) {
-      return ProcessResult::kHoist;
+      return Hoist(ltf);
     }
     return ProcessResult::kContinue;
   }
 
   ProcessResult Process(LoadTaggedField* ltf, const ProcessingState& state) {
-    if (ltf->property_key().type() != PropertyKey::kName) {
-      return ProcessResult::kContinue;
+    switch (ltf->property_key().type()) {
+      case PropertyKey::kName:
+        break;
+      case PropertyKey::kElements:
+        // Elements kind transitions might reallocate the elements.
+        if (loop_effects && loop_effects->elements_kind_transitioned) {
+          return ProcessResult::kContinue;
+        }
+        break;
+      default:
+        return ProcessResult::kContinue;
     }
     return ProcessNamedLoad(ltf, ltf->ValueInput().node(), ltf->property_key());
   }
@@ -326,6 +372,14 @@ class LoopOptimizationProcessor {
                             PropertyKey::TypedArrayLength());
   }
 
+  ProcessResult Process(UnsafeSmiUntag* untag, const ProcessingState& state) {
+    // Typically untags an array length that was just hoisted.
+    if (!loop_effects) return ProcessResult::kContinue;
+    if (IsLoopPhi(untag->input(0).node())) return ProcessResult::kContinue;
+    if (CanHoist(untag)) return Hoist(untag);
+    return ProcessResult::kContinue;
+  }
+
   ProcessResult ProcessNamedLoad(Node* load, ValueNode* object,
                                  PropertyKey name) {
     DCHECK(!load->properties().can_deopt());
@@ -333,15 +387,19 @@ class LoopOptimizationProcessor {
     if (IsLoopPhi(object)) {
       return ProcessResult::kContinue;
     }
+    if (!in_loop_header() && !checked_objects.count(object)) {
+      return ProcessResult::kContinue;
+    }
     if (!loop_effects->unstable_aspects_cleared &&
         !loop_effects->keys_cleared.count(name) &&
         !loop_effects->objects_written.count(object) && CanHoist(load)) {
-      return ProcessResult::kHoist;
+      return Hoist(load);
     }
     return ProcessResult::kContinue;
   }
 
-  ProcessResult Process(CheckMaps* maps, const ProcessingState& state) {
+  template <typename NodeT>
+  ProcessResult ProcessCheck(NodeT* check, bool depends_on_map) {
     DCHECK(loop_effects);
     // Hoisting a check out of a loop can cause it to trigger more than actually
     // needed (i.e., if the loop is executed 0 times). This could lead to
@@ -349,40 +407,73 @@ class LoopOptimizationProcessor {
     // abort this optimization if the function deoptimized previously. Also, if
     // hoisting of this check fails we need to abort (and not continue) to
     // ensure we are not hoisting other instructions over it.
-    if (was_deoptimized) return ProcessResult::kSkipBlock;
-    ValueNode* object = maps->ReceiverInput().node();
+    if (was_deoptimized) return StopHoisting();
+    ValueNode* object = check->input(0).node();
     if (IsLoopPhi(object)) {
-      return ProcessResult::kSkipBlock;
+      return StopHoisting();
     }
-    if (!loop_effects->unstable_aspects_cleared &&
-        !loop_effects->elements_kind_transitioned && CanHoist(maps)) {
-      if (auto j = current_block->predecessor_at(0)
+    if (depends_on_map && (loop_effects->unstable_aspects_cleared ||
+                           loop_effects->elements_kind_transitioned)) {
+      return StopHoisting();
+    }
+    if (CanHoist(check)) {
+      if (auto j = loop_header->forward_predecessor()
                        ->control_node()
                        ->TryCast<CheckpointedJump>()) {
-        maps->SetEagerDeoptInfo(
+        check->SetEagerDeoptInfo(
             zone, zone->New<DeoptFrame>(j->eager_deopt_info()->top_frame()),
-            maps->eager_deopt_info()->feedback_to_update());
-        return ProcessResult::kHoist;
+            check->eager_deopt_info()->feedback_to_update());
+        checked_objects.insert(object);
+        return Hoist(check);
       }
     }
-    return ProcessResult::kSkipBlock;
+    return StopHoisting();
+  }
+
+  ProcessResult Process(CheckMaps* maps, const ProcessingState& state) {
+    return ProcessCheck(maps, true);
+  }
+
+  // Checks of the type of a value don't depend on any loop effects.
+  ProcessResult Process(CheckSmi* check, const ProcessingState& state) {
+    return ProcessCheck(check, false);
+  }
+  ProcessResult Process(CheckHeapObject* check, const ProcessingState& state) {
+    return ProcessCheck(check, false);
+  }
+  ProcessResult Process(CheckNumber* check, const ProcessingState& state) {
+    return ProcessCheck(check, false);
+  }
+  ProcessResult Process(CheckString* check, const ProcessingState& state) {
+    return ProcessCheck(check, false);
   }
 
   template <typename NodeT>
   ProcessResult Process(NodeT* node, const ProcessingState& state) {
     // Ensure we are not hoisting over checks.
     if (node->properties().can_eager_deopt()) {
-      loop_effects = nullptr;
-      return ProcessResult::kSkipBlock;
+      return StopHoisting();
     }
     return ProcessResult::kContinue;
   }
 
+  ProcessResult StopHoisting() {
+    // This also keeps us from continuing with the loop body.
+    loop_effects = nullptr;
+    return ProcessResult::kSkipBlock;
+  }
+
   void PostProcessGraph(Graph* graph) {}
 
   Zone* zone;
   BasicBlock* current_block;
+  BasicBlock* loop_header = nullptr;
+  // The first block of the body of {loop_header}, if the header was fully
+  // processed.
+  BasicBlock* loop_body = nullptr;
   const LoopEffects* loop_effects;
+  // Objects whose map or type check was hoisted out of the current loop.
+  ZoneSet<ValueNode*> checked_objects;
   bool was_deoptimized;
 };
 
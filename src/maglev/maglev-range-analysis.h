@@ -457,6 +457,11 @@ class RangeProcessor {
     }
     if (node->operation() == Operation::kLessThan && node->if_true() == succ) {
       ranges_.AddLessEqualConstraint(succ, lhs, rhs);
+      // Typed array lengths are compared after a checked conversion, but
+      // bounds checked against the unconverted length.
+      if (auto conversion = rhs->TryCast<CheckedIntPtrToInt32>()) {
+        ranges_.AddLessEqualConstraint(succ, lhs, conversion->input_node(0));
+      }
     }
   }
 
@@ -800,7 +800,13 @@ ReduceResult MaglevReducer<BaseT>::ConvertForField(
       DCHECK(value->Is<TrustedConstant>());
       return value;
     case vobj::FieldType::kInt32:
-      // TODO(jgruber): Add conversions here once needed.
+      // Raw 32-bit fields such as dispatch handles are kept as Uint32 in the
+      // virtual object, so that deopts materialize them as (positive)
+      // numbers; their bits are stored unchanged.
+      if (Uint32Constant* constant = value->TryCast<Uint32Constant>()) {
+        return GetInt32Constant(static_cast<int32_t>(constant->value()));
+      }
+      // TODO(jgruber): Add more conversions here once needed.
       DCHECK_EQ(value->properties().value_representation(),
                 ValueRepresentation::kInt32);
       return value;
@@ -5721,6 +5727,50 @@ VirtualObject* MaglevReducer<BaseT>::CreateJSConstructor(
   return vobj;
 }
 
+template <typename BaseT>
+VirtualObject* MaglevReducer<BaseT>::CreateJSFunction(
+    compiler::MapRef map, compiler::SharedFunctionInfoRef shared,
+    compiler::FeedbackCellRef feedback_cell, JSDispatchHandle dispatch_handle,
+    ValueNode* context) {
+  DCHECK(map.IsJSFunctionMap());
+  DCHECK_EQ(map.GetInObjectProperties(), 0);
+  const bool has_prototype_slot =
+      InstanceTypeChecker::IsJSFunctionWithPrototype(map.instance_type());
+  const vobj::ObjectLayout* layout;
+  int slot_count;
+  if (has_prototype_slot) {
+    using Shape = VirtualJSFunctionWithPrototypeShape;
+    static_assert(Shape::kHeaderSize == JSFunctionWithPrototype::kHeaderSize);
+    layout = &Shape::kObjectLayout;
+    slot_count = Shape::header_slot_count;
+  } else {
+    using Shape = VirtualJSFunctionShape;
+    static_assert(Shape::kHeaderSize ==
+                  JSFunctionWithoutPrototype::kHeaderSize);
+    layout = &Shape::kObjectLayout;
+    slot_count = Shape::header_slot_count;
+  }
+  DCHECK_EQ(map.instance_size(), slot_count * kTaggedSize);
+  VirtualObject* vobj = NodeBase::New<VirtualObject>(
+      zone(), 0, NewObjectId(), zone(), layout, map, slot_count);
+  vobj->set(offsetof(HeapObject, map_), GetConstant(map));
+  vobj->set(offsetof(JSFunction, properties_or_hash_),
+            GetRootConstant(RootIndex::kEmptyFixedArray));
+  vobj->set(offsetof(JSFunction, elements_),
+            GetRootConstant(RootIndex::kEmptyFixedArray));
+  // The deoptimizer expects dispatch handles to be encoded as numbers.
+  vobj->set(offsetof(JSFunction, dispatch_handle_),
+            graph()->GetUint32Constant(dispatch_handle.value()));
+  vobj->set(offsetof(JSFunction, shared_function_info_), GetConstant(shared));
+  vobj->set(offsetof(JSFunction, context_), context);
+  vobj->set(offsetof(JSFunction, feedback_cell_), GetConstant(feedback_cell));
+  if (has_prototype_slot) {
+    vobj->set(offsetof(JSFunctionWithPrototype, prototype_or_initial_map_),
+              GetRootConstant(RootIndex::kTheHoleValue));
+  }
+  return vobj;
+}
+
 template <typename BaseT>
 VirtualObject* MaglevReducer<BaseT>::CreateFixedArray(
     base::Vector<ValueNode* const> values) {
@@ -989,6 +989,11 @@ class MaglevReducer {
                                        ValueNode* iterated_object,
                                        IterationKind kind);
   VirtualObject* CreateJSConstructor(compiler::JSFunctionRef constructor);
+  VirtualObject* CreateJSFunction(compiler::MapRef map,
+                                  compiler::SharedFunctionInfoRef shared,
+                                  compiler::FeedbackCellRef feedback_cell,
+                                  JSDispatchHandle dispatch_handle,
+                                  ValueNode* context);
   VirtualObject* CreateFixedArray(base::Vector<ValueNode* const> values);
   VirtualObject* CreateFixedDoubleArray(base::Vector<ValueNode* const> values);
   VirtualObject* CreateContext(compiler::MapRef map, int length,
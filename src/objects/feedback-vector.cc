@@ -11,6 +11,7 @@
 #include "src/common/globals.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/diagnostics/code-tracer.h"
+#include "src/execution/feedback-profile.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/ic/handler-configuration-inl.h"
@@ -335,6 +336,10 @@ Handle<FeedbackVector> FeedbackVector::New(
     i += entry_size;
   }
 
+  if (V8_UNLIKELY(isolate->feedback_profile())) {
+    isolate->feedback_profile()->ApplyFeedback(isolate, *vector);
+  }
+
   if (!isolate->is_best_effort_code_coverage()) {
     AddToVectorsForProfilingTools(isolate, vector);
   }
@@ -442,6 +447,21 @@ bool FeedbackVector::ClearSlots(Isolate* isolate, ClearBehavior behavior) {
   return feedback_updated;
 }
 
+void FeedbackVector::ClearForSerializationWithFeedback(Isolate* isolate) {
+  if (shared_function_info()->HasFeedbackMetadata()) {
+    DisallowGarbageCollection no_gc;
+    FeedbackMetadataIterator iter(metadata(), no_gc);
+    while (iter.HasNext()) {
+      FeedbackSlot slot = iter.Next();
+      if (iter.kind() != FeedbackSlotKind::kJumpLoop) continue;
+      FeedbackNexus nexus(isolate, this, slot);
+      nexus.Clear(ClearBehavior::kDefault);
+    }
+  }
+  reset_flags();
+  reset_osr_state();
+}
+
 #ifdef V8_TRACE_FEEDBACK_UPDATES
 
 // static
@@ -1086,6 +1106,19 @@ int FeedbackNexus::GetCallCount() {
   return CallCountField::decode(value);
 }
 
+void FeedbackNexus::SetCallCount(uint32_t count) {
+  DCHECK(IsCallICKind(kind()));
+
+  Tagged<Object> call_count = Cast<Object>(GetFeedbackExtra());
+  CHECK(IsSmi(call_count));
+  uint32_t value = static_cast<uint32_t>(Smi::ToInt(call_count));
+  value = CallCountField::update(
+      value, std::min(count, static_cast<uint32_t>(CallCountField::kMax)));
+  Tagged<MaybeObject> feedback = GetFeedback();
+  SetFeedback(feedback, UPDATE_WRITE_BARRIER, Smi::FromInt(value),
+              SKIP_WRITE_BARRIER);
+}
+
 void FeedbackNexus::SetSpeculationMode(SpeculationMode mode) {
   DCHECK(IsCallICKind(kind()) || kind() == FeedbackSlotKind::kJumpLoop);
 
@@ -1484,6 +1517,19 @@ ForInHint FeedbackNexus::GetForInFeedback() const {
   return ForInHintFromFeedback(static_cast<ForInFeedback>(feedback));
 }
 
+int FeedbackNexus::GetAccumulatedFeedback() const {
+  DCHECK(kind() == FeedbackSlotKind::kBinaryOp ||
+         kind() == FeedbackSlotKind::kStringAddAndInternalize ||
+         kind() == FeedbackSlotKind::kCompareOp ||
+         kind() == FeedbackSlotKind::kForIn);
+  return GetFeedback().ToSmi().value();
+}
+
+void FeedbackNexus::AccumulateFeedback(int feedback) {
+  int accumulated = GetAccumulatedFeedback() | feedback;
+  SetFeedback(Smi::FromInt(accumulated), SKIP_WRITE_BARRIER);
+}
+
 MaybeDirectHandle<JSObject> FeedbackNexus::GetConstructorFeedback() const {
   DCHECK_EQ(kind(), FeedbackSlotKind::kInstanceOf);
   Tagged<MaybeObject> feedback = GetFeedback();
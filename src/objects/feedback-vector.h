@@ -496,6 +496,11 @@ V8_OBJECT class FeedbackVector : public HeapObject {
     return ClearSlots(isolate, ClearBehavior::kClearAll);
   }
 
+  // Prepares the vector for being serialized together with its feedback.
+  // Drops cached OSR code, which cannot be serialized, and pending tiering
+  // requests.
+  void ClearForSerializationWithFeedback(Isolate* isolate);
+
   // The object that indicates an uninitialized cache.
   static inline DirectHandle<Symbol> UninitializedSentinel(Isolate* isolate);
 
@@ -1057,6 +1062,11 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
   TypeOfFeedback::Result GetTypeOfFeedback() const;
   ForInHint GetForInFeedback() const;
 
+  // For BinaryOp, CompareOp, ForIn and StringAddAndInternalize ICs, whose
+  // feedback is a Smi of bits that only ever accumulate.
+  int GetAccumulatedFeedback() const;
+  void AccumulateFeedback(int feedback);
+
   // For KeyedLoad ICs.
   KeyedAccessLoadMode GetKeyedAccessLoadMode() const;
 
@@ -1070,6 +1080,7 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
 
   // For Call ICs.
   int GetCallCount();
+  void SetCallCount(uint32_t count);
   void SetSpeculationMode(SpeculationMode mode);
   void NextSpeculationMode(SpeculationMode mode);
   SpeculationMode GetSpeculationMode();
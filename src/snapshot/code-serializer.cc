@@ -471,6 +471,24 @@ const char* ToString(SerializedCodeSanityCheckResult result) {
   }
   UNREACHABLE();
 }
+
+void RecordRejection(Isolate* isolate, SerializedCodeSanityCheckResult result) {
+  isolate->counters()->code_cache_reject_reason()->AddSample(
+      static_cast<int>(result));
+  isolate->code_cache_reject_counts()[static_cast<int>(result)]++;
+}
+
+void RecordAcceptance(Isolate* isolate, const SerializedCodeData& scd) {
+  isolate->set_code_cache_accepted_count(isolate->code_cache_accepted_count() +
+                                         1);
+  if (!scd.FlagsMatchExactly()) {
+    if (v8_flags.profile_deserialization) {
+      PrintF("[Cached code accepted despite irrelevant flags mismatch]\n");
+    }
+    isolate->set_code_cache_accepted_with_flags_mismatch_count(
+        isolate->code_cache_accepted_with_flags_mismatch_count() + 1);
+  }
+}
 }  // namespace
 
 MaybeDirectHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
@@ -509,8 +527,7 @@ MaybeDirectHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
       PrintF("[Cached code failed check: %s]\n", ToString(sanity_check_result));
     }
     DCHECK(cached_data->rejected());
-    isolate->counters()->code_cache_reject_reason()->AddSample(
-        static_cast<int>(sanity_check_result));
+    RecordRejection(isolate, sanity_check_result);
     return MaybeDirectHandle<SharedFunctionInfo>();
   }
 
@@ -524,6 +541,7 @@ MaybeDirectHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     if (v8_flags.profile_deserialization) PrintF("[Deserializing failed]\n");
     return MaybeDirectHandle<SharedFunctionInfo>();
   }
+  RecordAcceptance(isolate, scd);
 
   // Check whether the newly deserialized data should be merged into an
   // existing Script from the Isolate compilation cache. If so, perform
@@ -646,8 +664,7 @@ CodeSerializer::FinishOffThreadDeserialize(
       PrintF("[Cached code failed check: %s]\n", ToString(sanity_check_result));
     }
     DCHECK(cached_data->rejected());
-    isolate->counters()->code_cache_reject_reason()->AddSample(
-        static_cast<int>(sanity_check_result));
+    RecordRejection(isolate, sanity_check_result);
     return MaybeDirectHandle<SharedFunctionInfo>();
   }
 
@@ -659,6 +676,7 @@ CodeSerializer::FinishOffThreadDeserialize(
     }
     return MaybeDirectHandle<SharedFunctionInfo>();
   }
+  RecordAcceptance(isolate, scd);
 
   // Change the result persistent handle into a regular handle.
   DCHECK(data.persistent_handles->Contains(result.location()));
@@ -742,6 +760,7 @@ SerializedCodeData::SerializedCodeData(const std::vector<uint8_t>* payload,
   SetHeaderValue(kVersionHashOffset, Version::Hash());
   SetHeaderValue(kSourceHashOffset, cs->source_hash());
   SetHeaderValue(kFlagHashOffset, FlagList::Hash());
+  SetHeaderValue(kCodeCacheFlagHashOffset, FlagList::CodeCacheHash());
   SetHeaderValue(kReadOnlySnapshotChecksumOffset,
                  Snapshot::ExtractReadOnlySnapshotChecksum(
                      cs->isolate()->snapshot_blob()));
@@ -790,9 +809,12 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
   if (version_hash != Version::Hash()) {
     return SerializedCodeSanityCheckResult::kVersionMismatch;
   }
-  uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
-  if (flags_hash != FlagList::Hash()) {
-    return SerializedCodeSanityCheckResult::kFlagsMismatch;
+  if (!FlagsMatchExactly()) {
+    uint32_t code_cache_flags_hash = GetHeaderValue(kCodeCacheFlagHashOffset);
+    if (!v8_flags.code_cache_relaxed_flag_check ||
+        code_cache_flags_hash != FlagList::CodeCacheHash()) {
+      return SerializedCodeSanityCheckResult::kFlagsMismatch;
+    }
   }
   uint32_t ro_snapshot_checksum =
       GetHeaderValue(kReadOnlySnapshotChecksumOffset);
@@ -813,6 +835,10 @@ SerializedCodeSanityCheckResult SerializedCodeData::SanityCheckWithoutSource(
   return SerializedCodeSanityCheckResult::kSuccess;
 }
 
+bool SerializedCodeData::FlagsMatchExactly() const {
+  return GetHeaderValue(kFlagHashOffset) == FlagList::Hash();
+}
+
 uint32_t SerializedCodeData::SourceHash(
     DirectHandle<String> source, DirectHandle<FixedArray> wrapped_arguments,
     ScriptOriginOptions origin_options) {
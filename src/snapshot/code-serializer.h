@@ -54,8 +54,10 @@ typedef v8::ScriptCompiler::CachedData::CompatibilityCheckResult
     SerializedCodeSanityCheckResult;
 
 // If this fails, update the static_assert AND the code_cache_reject_reason
-// histogram definition.
+// histogram definition AND Isolate::kCodeCacheRejectReasonCount.
 static_assert(static_cast<int>(SerializedCodeSanityCheckResult::kLast) == 9);
+static_assert(static_cast<int>(SerializedCodeSanityCheckResult::kLast) + 1 ==
+              Isolate::kCodeCacheRejectReasonCount);
 
 class CodeSerializer : public Serializer {
  public:
@@ -118,8 +120,10 @@ class SerializedCodeData : public SerializedData {
   static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
   static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
   static const uint32_t kFlagHashOffset = kSourceHashOffset + kUInt32Size;
-  static const uint32_t kReadOnlySnapshotChecksumOffset =
+  static const uint32_t kCodeCacheFlagHashOffset =
       kFlagHashOffset + kUInt32Size;
+  static const uint32_t kReadOnlySnapshotChecksumOffset =
+      kCodeCacheFlagHashOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset =
       kReadOnlySnapshotChecksumOffset + kUInt32Size;
   static const uint32_t kChecksumOffset = kPayloadLengthOffset + kUInt32Size;
@@ -152,6 +156,11 @@ class SerializedCodeData : public SerializedData {
 
   base::Vector<const uint8_t> Payload() const;
 
+  // Whether the data was produced with exactly the current flags. With
+  // --code-cache-relaxed-flag-check, data produced with flags that only differ
+  // in ways that cannot affect the cached data passes the sanity check too.
+  bool FlagsMatchExactly() const;
+
   static uint32_t SourceHash(DirectHandle<String> source,
                              DirectHandle<FixedArray> wrapped_arguments,
                              ScriptOriginOptions origin_options);
@@ -7,6 +7,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
 #include "src/common/assert-scope.h"
+#include "src/init/startup-timeline.h"
 #include "src/logging/counters-scopes.h"
 #include "src/snapshot/serializer-deserializer.h"
 
@@ -24,6 +25,8 @@ MaybeDirectHandle<Context> ContextDeserializer::DeserializeContext(
   if (V8_UNLIKELY(v8_flags.profile_deserialization)) timer.Start();
   NestedTimedHistogramScope histogram_timer(
       isolate->counters()->snapshot_deserialize_context());
+  StartupTimeline::Scope timeline_scope(
+      isolate, StartupTimeline::Phase::kContextDeserialization);
 
   ContextDeserializer d(isolate, data, can_rehash);
   MaybeDirectHandle<Object> maybe_result =
@@ -62,10 +65,14 @@ MaybeDirectHandle<Object> ContextDeserializer::Deserialize(
     result = ReadObject();
     DCHECK(IsNativeContext(*result));
     DeserializeDeferredObjects();
-    DeserializeEmbedderFields(Cast<NativeContext>(result),
-                              embedder_fields_deserializer);
-    DeserializeApiWrapperFields(
-        embedder_fields_deserializer.api_wrapper_callback);
+    {
+      StartupTimeline::Scope timeline_scope(
+          isolate, StartupTimeline::Phase::kEmbedderFieldCallbacks);
+      DeserializeEmbedderFields(Cast<NativeContext>(result),
+                                embedder_fields_deserializer);
+      DeserializeApiWrapperFields(
+          embedder_fields_deserializer.api_wrapper_callback);
+    }
     LogNewMapEvents();
   }
 
@@ -154,8 +154,12 @@ void ContextSerializer::SerializeObjectImpl(Handle<HeapObject> obj,
 
   InstanceType instance_type = obj->map()->instance_type();
   if (InstanceTypeChecker::IsFeedbackVector(instance_type)) {
-    // Clear literal boilerplates and feedback.
-    Cast<FeedbackVector>(obj)->ClearSlots(isolate());
+    if (keep_feedback()) {
+      Cast<FeedbackVector>(obj)->ClearForSerializationWithFeedback(isolate());
+    } else {
+      // Clear literal boilerplates and feedback.
+      Cast<FeedbackVector>(obj)->ClearSlots(isolate());
+    }
   } else if (InstanceTypeChecker::IsJSObject(instance_type)) {
     Handle<JSObject> js_obj = Cast<JSObject>(obj);
     int embedder_fields_count = js_obj->GetEmbedderFieldCount();
@@ -6,6 +6,12 @@
 
 #include <inttypes.h>
 
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 #include "src/base/logging.h"
 #include "src/base/strong-alias.h"
 #include "src/codegen/assembler-inl.h"
@@ -18,6 +24,7 @@
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/heap.h"
 #include "src/heap/local-heap-inl.h"
+#include "src/init/v8.h"
 #include "src/logging/local-logger.h"
 #include "src/logging/log.h"
 #include "src/objects/backing-store.h"
@@ -28,7 +35,7 @@
 #include "src/objects/objects-body-descriptors-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/slots.h"
-#include "src/objects/string.h"
+#include "src/objects/string-inl.h"
 #include "src/roots/roots.h"
 #include "src/sandbox/js-dispatch-table-inl.h"
 #include "src/snapshot/embedded/embedded-data-inl.h"
@@ -337,7 +344,8 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
       deserializing_user_code_(deserializing_user_code),
       should_rehash_((v8_flags.rehash_snapshot && can_rehash) ||
                      deserializing_user_code),
-      to_rehash_(isolate) {
+      to_rehash_(isolate),
+      strings_to_hash_(isolate) {
   DCHECK_NOT_NULL(isolate);
   isolate->RegisterDeserializerStarted();
 
@@ -356,9 +364,75 @@ Deserializer<IsolateT>::Deserializer(IsolateT* isolate,
   CHECK_EQ(magic_number_, SerializedData::kMagicNumber);
 }
 
+namespace {
+
+// Computes the hashes of freshly deserialized strings. The strings are not
+// reachable by anyone else yet and the main thread is blocked in Join() without
+// allocating, so they can be accessed without a LocalHeap. The hash field is
+// written atomically.
+class StringHashingJob final : public v8::JobTask {
+ public:
+  explicit StringHashingJob(base::Vector<const Tagged<String>> strings)
+      : strings_(strings) {}
+
+  StringHashingJob(const StringHashingJob&) = delete;
+  StringHashingJob& operator=(const StringHashingJob&) = delete;
+
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      const size_t start =
+          next_string_.fetch_add(kBatchSize, std::memory_order_relaxed);
+      if (start >= strings_.size()) return;
+      const size_t end = std::min(start + kBatchSize, strings_.size());
+      for (size_t i = start; i < end; i++) {
+        strings_[i]->EnsureHash(SharedStringAccessGuardIfNeeded::NotNeeded());
+      }
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next = next_string_.load(std::memory_order_relaxed);
+    if (next >= strings_.size()) return 0;
+    return std::min(kMaxTasks,
+                    (strings_.size() - next + kBatchSize - 1) / kBatchSize);
+  }
+
+  // Below this many strings hashing on the main thread is cheaper than
+  // spinning up the job.
+  static constexpr size_t kMinStringsForParallelHashing = 4096;
+
+ private:
+  static constexpr size_t kBatchSize = 512;
+  static constexpr size_t kMaxTasks = 8;
+
+  const base::Vector<const Tagged<String>> strings_;
+  std::atomic<size_t> next_string_{0};
+};
+
+}  // namespace
+
 template <typename IsolateT>
 void Deserializer<IsolateT>::Rehash() {
   DCHECK(should_rehash());
+  // Without worker threads the strings are hashed lazily by the tables that
+  // use them as keys.
+  if (strings_to_hash_.size() >=
+          StringHashingJob::kMinStringsForParallelHashing &&
+      V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0) {
+    DCHECK(v8_flags.parallel_snapshot_string_hashing);
+    DisallowGarbageCollection no_gc;
+    std::vector<Tagged<String>> strings;
+    strings.reserve(strings_to_hash_.size());
+    for (DirectHandle<String> string : strings_to_hash_) {
+      strings.push_back(*string);
+    }
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<StringHashingJob>(
+                        base::VectorOf(strings.data(), strings.size())))
+        ->Join();
+  }
   for (DirectHandle<HeapObject> item : to_rehash_) {
     item->RehashBasedOnMap(isolate());
   }
@@ -608,6 +682,11 @@ void Deserializer<IsolateT>::PostProcessNewObject(DirectHandle<Map> map,
       // read-only space are rehashed lazily. (e.g. when rehashing dictionaries)
       if (space == SnapshotSpace::kReadOnlyHeap) {
         PushObjectToRehash(obj);
+      } else if (std::is_same_v<IsolateT, Isolate> &&
+                 !deserializing_user_code() &&
+                 v8_flags.parallel_snapshot_string_hashing &&
+                 InstanceTypeChecker::IsSeqString(instance_type)) {
+        strings_to_hash_.push_back(Cast<String>(obj));
       }
     } else if (raw_obj->NeedsRehashing(instance_type)) {
       PushObjectToRehash(obj);
@@ -325,6 +325,9 @@ class Deserializer : public SerializerDeserializer {
   // TODO(6593): generalize rehashing, and remove this flag.
   const bool should_rehash_;
   DirectHandleVector<HeapObject> to_rehash_;
+  // Sequential strings outside of read-only space whose hashes are computed in
+  // parallel before rehashing, instead of lazily by the tables using them.
+  DirectHandleVector<String> strings_to_hash_;
 
   // Do not collect any gc stats during deserialization since objects might
   // be in an invalid state
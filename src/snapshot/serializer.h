@@ -319,6 +319,10 @@ class Serializer : public SerializerDeserializer {
     return (flags_ & Snapshot::kAllowActiveIsolateForTesting) != 0;
   }
 
+  bool keep_feedback() const {
+    return (flags_ & Snapshot::kKeepFeedback) != 0;
+  }
+
   bool reconstruct_read_only_and_shared_object_caches_for_testing() const {
     return (flags_ &
             Snapshot::kReconstructReadOnlyAndSharedObjectCachesForTesting) != 0;
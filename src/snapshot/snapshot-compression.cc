@@ -4,7 +4,17 @@
 
 #include "src/snapshot/snapshot-compression.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "include/v8-platform.h"
 #include "src/base/platform/elapsed-timer.h"
+#include "src/flags/flags.h"
+#include "src/init/v8.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 #include "third_party/zlib/google/compression_utils_portable.h"
@@ -12,47 +22,413 @@
 namespace v8 {
 namespace internal {
 
+// Compressed snapshots start with the following uint32_t-sized entries:
+// [0] uncompressed payload length
+// [1] SnapshotCompressionCodec
+// ... codec specific data
+constexpr uint32_t kUncompressedSizeOffset = 0;
+constexpr uint32_t kCodecOffset = kUncompressedSizeOffset + kUInt32Size;
+constexpr uint32_t kCompressedHeaderSize = kCodecOffset + kUInt32Size;
+
 uint32_t GetUncompressedSize(const Bytef* compressed_data) {
   uint32_t size;
-  MemCopy(&size, compressed_data, sizeof(size));
+  MemCopy(&size, compressed_data + kUncompressedSizeOffset, sizeof(size));
   return size;
 }
 
+namespace {
+
+SnapshotCompressionCodec GetCodec(const uint8_t* compressed_data) {
+  uint32_t codec;
+  MemCopy(&codec, compressed_data + kCodecOffset, sizeof(codec));
+  CHECK_LE(codec, static_cast<uint32_t>(SnapshotCompressionCodec::kLz));
+  return static_cast<SnapshotCompressionCodec>(codec);
+}
+
+// Returns the size of the compressed data.
+size_t ZlibCompress(base::Vector<const uint8_t> input, uint8_t* output,
+                    size_t output_size) {
+  static_assert(sizeof(Bytef) == 1, "");
+  uLongf compressed_data_size = static_cast<uLongf>(output_size);
+  // Since we are doing raw compression (no zlib or gzip headers), the
+  // uncompressed size is stored in our own header.
+  CHECK_EQ(zlib_internal::CompressHelper(
+               zlib_internal::ZRAW, output, &compressed_data_size,
+               reinterpret_cast<const Bytef*>(input.begin()),
+               static_cast<uLongf>(input.size()), Z_DEFAULT_COMPRESSION,
+               nullptr, nullptr),
+           Z_OK);
+  return compressed_data_size;
+}
+
+void ZlibDecompress(base::Vector<const uint8_t> input, uint8_t* output,
+                    size_t output_size) {
+  uLongf uncompressed_size = static_cast<uLongf>(output_size);
+  CHECK_EQ(zlib_internal::UncompressHelper(
+               zlib_internal::ZRAW, output, &uncompressed_size,
+               reinterpret_cast<const Bytef*>(input.begin()),
+               static_cast<uLong>(input.size())),
+           Z_OK);
+  CHECK_EQ(uncompressed_size, output_size);
+}
+
+// A byte oriented LZ77 format in the spirit of LZ4. The input is split into
+// blocks that are compressed independently, so that they can be decompressed
+// in parallel:
+// [0] number of blocks
+// [1..n] compressed size of each block, kStoredBlockBit marks blocks that
+//        are stored uncompressed
+// ... the blocks
+//
+// A block is a sequence of (token, literals, match) triples. The upper 4 bits
+// of the token hold the number of literals, the lower 4 bits the match length
+// minus kMinMatch. A value of 15 is continued in the following bytes, which
+// are added up until a byte differs from 255. A match is encoded as a 16-bit
+// little-endian backwards offset. The last sequence of a block only has
+// literals.
+class LzBlockCodec final : public AllStatic {
+ public:
+  static constexpr size_t kBlockSize = 64 * KB;
+  static constexpr uint32_t kStoredBlockBit = uint32_t{1} << 31;
+
+  static size_t BlockCount(size_t size) {
+    return (size + kBlockSize - 1) / kBlockSize;
+  }
+
+  static size_t CompressBound(size_t size) { return size + size / 255 + 16; }
+
+  // Returns the size of the compressed block in `output`, which must hold at
+  // least CompressBound(input_size) bytes.
+  static size_t CompressBlock(const uint8_t* input, size_t input_size,
+                              uint8_t* output) {
+    DCHECK_LE(input_size, kBlockSize);
+    // Positions in the block fit into 16 bits, so do offsets.
+    std::array<int32_t, kHashTableSize> table;
+    table.fill(-1);
+    uint8_t* out = output;
+    size_t anchor = 0;
+    size_t pos = 0;
+    while (pos + kMinMatch <= input_size) {
+      const uint32_t sequence = Read32(input + pos);
+      const uint32_t hash = Hash(sequence);
+      const int32_t candidate = table[hash];
+      table[hash] = static_cast<int32_t>(pos);
+      if (candidate < 0 || Read32(input + candidate) != sequence) {
+        // Skip faster through incompressible data.
+        pos += 1 + ((pos - anchor) >> kSkipShift);
+        continue;
+      }
+      size_t match_length = kMinMatch;
+      while (pos + match_length < input_size &&
+             input[candidate + match_length] == input[pos + match_length]) {
+        match_length++;
+      }
+      out = EmitLiterals(out, input + anchor, pos - anchor, match_length);
+      const size_t offset = pos - candidate;
+      DCHECK(offset > 0 && offset <= kMaxOffset);
+      *out++ = static_cast<uint8_t>(offset);
+      *out++ = static_cast<uint8_t>(offset >> 8);
+      if (match_length - kMinMatch >= kTokenMask) {
+        out = EmitLength(out, match_length - kMinMatch - kTokenMask);
+      }
+      pos += match_length;
+      anchor = pos;
+    }
+    out = EmitLiterals(out, input + anchor, input_size - anchor, 0);
+    DCHECK_LE(static_cast<size_t>(out - output), CompressBound(input_size));
+    return out - output;
+  }
+
+  // Returns false if the block is malformed or does not decompress to exactly
+  // `output_size` bytes.
+  static bool DecompressBlock(const uint8_t* input, size_t input_size,
+                              uint8_t* output, size_t output_size) {
+    const uint8_t* in = input;
+    const uint8_t* const in_end = input + input_size;
+    uint8_t* out = output;
+    uint8_t* const out_end = output + output_size;
+    while (true) {
+      if (in >= in_end) return false;
+      const uint8_t token = *in++;
+      size_t literals = token >> kTokenBits;
+      if (literals == kTokenMask && !ReadLength(&in, in_end, &literals)) {
+        return false;
+      }
+      if (literals > static_cast<size_t>(in_end - in) ||
+          literals > static_cast<size_t>(out_end - out)) {
+        return false;
+      }
+      std::memcpy(out, in, literals);
+      in += literals;
+      out += literals;
+      if (in == in_end) break;
+
+      if (in_end - in < 2) return false;
+      const size_t offset = in[0] | (in[1] << 8);
+      in += 2;
+      if (offset == 0 || offset > static_cast<size_t>(out - output)) {
+        return false;
+      }
+      size_t match_length = token & kTokenMask;
+      if (match_length == kTokenMask &&
+          !ReadLength(&in, in_end, &match_length)) {
+        return false;
+      }
+      match_length += kMinMatch;
+      if (match_length > static_cast<size_t>(out_end - out)) return false;
+      const uint8_t* from = out - offset;
+      if (offset >= match_length) {
+        std::memcpy(out, from, match_length);
+        out += match_length;
+      } else {
+        // Overlapping matches repeat the last `offset` bytes.
+        for (size_t i = 0; i < match_length; i++) *out++ = *from++;
+      }
+    }
+    return out == out_end;
+  }
+
+ private:
+  static constexpr size_t kMinMatch = 4;
+  static constexpr size_t kMaxOffset = kBlockSize - 1;
+  static constexpr int kTokenBits = 4;
+  static constexpr size_t kTokenMask = (1 << kTokenBits) - 1;
+  static constexpr int kHashBits = 12;
+  static constexpr size_t kHashTableSize = size_t{1} << kHashBits;
+  static constexpr int kSkipShift = 6;
+
+  static uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+  }
+
+  static uint32_t Hash(uint32_t sequence) {
+    return (sequence * 2654435761u) >> (32 - kHashBits);
+  }
+
+  static uint8_t* EmitLength(uint8_t* out, size_t length) {
+    while (length >= 255) {
+      *out++ = 255;
+      length -= 255;
+    }
+    *out++ = static_cast<uint8_t>(length);
+    return out;
+  }
+
+  // Emits the token and the literals of a sequence.
+  static uint8_t* EmitLiterals(uint8_t* out, const uint8_t* literals,
+                               size_t count, size_t match_length) {
+    const size_t literal_bits = std::min(count, kTokenMask);
+    const size_t match_bits =
+        match_length == 0 ? 0 : std::min(match_length - kMinMatch, kTokenMask);
+    *out++ = static_cast<uint8_t>((literal_bits << kTokenBits) | match_bits);
+    if (count >= kTokenMask) out = EmitLength(out, count - kTokenMask);
+    std::memcpy(out, literals, count);
+    return out + count;
+  }
+
+  static bool ReadLength(const uint8_t** in, const uint8_t* in_end,
+                         size_t* length) {
+    uint8_t byte;
+    do {
+      if (*in >= in_end) return false;
+      byte = *(*in)++;
+      *length += byte;
+    } while (byte == 255);
+    return true;
+  }
+};
+
+size_t LzCompress(base::Vector<const uint8_t> input, uint8_t* output) {
+  const size_t block_count = LzBlockCodec::BlockCount(input.size());
+  uint8_t* sizes = output + kUInt32Size;
+  uint8_t* out = sizes + block_count * kUInt32Size;
+  const uint32_t block_count_value = static_cast<uint32_t>(block_count);
+  MemCopy(output, &block_count_value, kUInt32Size);
+  std::unique_ptr<uint8_t[]> scratch(
+      new uint8_t[LzBlockCodec::CompressBound(LzBlockCodec::kBlockSize)]);
+  for (size_t i = 0; i < block_count; i++) {
+    const size_t start = i * LzBlockCodec::kBlockSize;
+    const size_t size =
+        std::min(LzBlockCodec::kBlockSize, input.size() - start);
+    size_t compressed_size =
+        LzBlockCodec::CompressBlock(input.begin() + start, size, scratch.get());
+    uint32_t size_value;
+    if (compressed_size < size) {
+      MemCopy(out, scratch.get(), compressed_size);
+      size_value = static_cast<uint32_t>(compressed_size);
+    } else {
+      MemCopy(out, input.begin() + start, size);
+      compressed_size = size;
+      size_value = static_cast<uint32_t>(size) | LzBlockCodec::kStoredBlockBit;
+    }
+    MemCopy(sizes + i * kUInt32Size, &size_value, kUInt32Size);
+    out += compressed_size;
+  }
+  return out - output;
+}
+
+size_t LzCompressBound(size_t size) {
+  const size_t block_count = LzBlockCodec::BlockCount(size);
+  return kUInt32Size + block_count * kUInt32Size +
+         block_count * LzBlockCodec::CompressBound(LzBlockCodec::kBlockSize);
+}
+
+struct LzBlock {
+  base::Vector<const uint8_t> input;
+  bool stored;
+};
+
+void DecompressLzBlock(const LzBlock& block, uint8_t* output,
+                       size_t output_size) {
+  if (block.stored) {
+    CHECK_EQ(block.input.size(), output_size);
+    MemCopy(output, block.input.begin(), output_size);
+    return;
+  }
+  CHECK(LzBlockCodec::DecompressBlock(block.input.begin(), block.input.size(),
+                                      output, output_size));
+}
+
+// Decompresses the blocks of an lz-compressed snapshot. The main thread joins
+// the job, so it works on blocks as well.
+class LzDecompressionJob final : public v8::JobTask {
+ public:
+  LzDecompressionJob(const std::vector<LzBlock>& blocks,
+                     base::Vector<uint8_t> output)
+      : blocks_(blocks), output_(output) {}
+
+  LzDecompressionJob(const LzDecompressionJob&) = delete;
+  LzDecompressionJob& operator=(const LzDecompressionJob&) = delete;
+
+  // v8::JobTask overrides.
+  void Run(JobDelegate* delegate) override {
+    while (!delegate->ShouldYield()) {
+      const size_t index = next_block_.fetch_add(1, std::memory_order_relaxed);
+      if (index >= blocks_.size()) return;
+      const size_t start = index * LzBlockCodec::kBlockSize;
+      DecompressLzBlock(
+          blocks_[index], output_.begin() + start,
+          std::min(LzBlockCodec::kBlockSize, output_.size() - start));
+    }
+  }
+
+  size_t GetMaxConcurrency(size_t worker_count) const override {
+    const size_t next = next_block_.load(std::memory_order_relaxed);
+    if (next >= blocks_.size()) return 0;
+    return std::min(kMaxTasks, blocks_.size() - next);
+  }
+
+  // Below this many blocks decompressing on the main thread is cheaper than
+  // spinning up the job.
+  static constexpr size_t kMinBlocksForParallelDecompression = 8;
+
+ private:
+  static constexpr size_t kMaxTasks = 8;
+
+  const std::vector<LzBlock>& blocks_;
+  const base::Vector<uint8_t> output_;
+  std::atomic<size_t> next_block_{0};
+};
+
+void LzDecompress(base::Vector<const uint8_t> input,
+                  base::Vector<uint8_t> output) {
+  CHECK_GE(input.size(), kUInt32Size);
+  uint32_t block_count;
+  MemCopy(&block_count, input.begin(), kUInt32Size);
+  CHECK_EQ(block_count, LzBlockCodec::BlockCount(output.size()));
+  CHECK_GE(input.size() - kUInt32Size,
+           static_cast<size_t>(block_count) * kUInt32Size);
+  const uint8_t* sizes = input.begin() + kUInt32Size;
+  size_t offset = kUInt32Size + block_count * kUInt32Size;
+  std::vector<LzBlock> blocks;
+  blocks.reserve(block_count);
+  for (uint32_t i = 0; i < block_count; i++) {
+    uint32_t size_value;
+    MemCopy(&size_value, sizes + i * kUInt32Size, kUInt32Size);
+    const size_t size = size_value & ~LzBlockCodec::kStoredBlockBit;
+    CHECK_LE(size, input.size() - offset);
+    blocks.push_back({input.SubVector(offset, offset + size),
+                      (size_value & LzBlockCodec::kStoredBlockBit) != 0});
+    offset += size;
+  }
+  CHECK_EQ(offset, input.size());
+
+  if (v8_flags.parallel_snapshot_decompression &&
+      blocks.size() >= LzDecompressionJob::kMinBlocksForParallelDecompression &&
+      V8::GetCurrentPlatform()->NumberOfWorkerThreads() > 0) {
+    V8::GetCurrentPlatform()
+        ->CreateJob(TaskPriority::kUserBlocking,
+                    std::make_unique<LzDecompressionJob>(blocks, output))
+        ->Join();
+    return;
+  }
+  for (size_t i = 0; i < blocks.size(); i++) {
+    const size_t start = i * LzBlockCodec::kBlockSize;
+    DecompressLzBlock(
+        blocks[i], output.begin() + start,
+        std::min(LzBlockCodec::kBlockSize, output.size() - start));
+  }
+}
+
+}  // namespace
+
+// static
+std::optional<SnapshotCompressionCodec> SnapshotCompression::CodecFromString(
+    const char* name) {
+  if (name == nullptr) return {};
+  if (strcmp(name, "zlib") == 0) return SnapshotCompressionCodec::kZlib;
+  if (strcmp(name, "lz") == 0) return SnapshotCompressionCodec::kLz;
+  return {};
+}
+
 SnapshotData SnapshotCompression::Compress(
     const SnapshotData* uncompressed_data) {
+  std::optional<SnapshotCompressionCodec> codec =
+      CodecFromString(v8_flags.snapshot_compression_codec.value());
+  if (!codec.has_value()) {
+    FATAL("Unknown snapshot compression codec '%s'",
+          v8_flags.snapshot_compression_codec.value());
+  }
+  return Compress(uncompressed_data, codec.value());
+}
+
+SnapshotData SnapshotCompression::Compress(
+    const SnapshotData* uncompressed_data, SnapshotCompressionCodec codec) {
   SnapshotData snapshot_data;
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  static_assert(sizeof(Bytef) == 1, "");
-  const uLongf input_size =
-      static_cast<uLongf>(uncompressed_data->RawData().size());
-  uint32_t payload_length =
-      static_cast<uint32_t>(uncompressed_data->RawData().size());
+  const base::Vector<const uint8_t> input = uncompressed_data->RawData();
+  uint32_t payload_length = static_cast<uint32_t>(input.size());
 
-  uLongf compressed_data_size = compressBound(input_size);
+  const size_t compressed_data_bound =
+      codec == SnapshotCompressionCodec::kZlib
+          ? compressBound(static_cast<uLongf>(input.size()))
+          : LzCompressBound(input.size());
 
   // Allocating >= the final amount we will need.
   snapshot_data.AllocateData(
-      static_cast<uint32_t>(sizeof(payload_length) + compressed_data_size));
+      static_cast<uint32_t>(kCompressedHeaderSize + compressed_data_bound));
 
   uint8_t* compressed_data =
       const_cast<uint8_t*>(snapshot_data.RawData().begin());
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually store the uncompressed size.
-  MemCopy(compressed_data, &payload_length, sizeof(payload_length));
-
-  CHECK_EQ(
-      zlib_internal::CompressHelper(
-          zlib_internal::ZRAW, compressed_data + sizeof(payload_length),
-          &compressed_data_size,
-          reinterpret_cast<const Bytef*>(uncompressed_data->RawData().begin()),
-          input_size, Z_DEFAULT_COMPRESSION, nullptr, nullptr),
-      Z_OK);
+  const uint32_t codec_value = static_cast<uint32_t>(codec);
+  MemCopy(compressed_data + kUncompressedSizeOffset, &payload_length,
+          sizeof(payload_length));
+  MemCopy(compressed_data + kCodecOffset, &codec_value, sizeof(codec_value));
+
+  uint8_t* output = compressed_data + kCompressedHeaderSize;
+  const size_t compressed_data_size =
+      codec == SnapshotCompressionCodec::kZlib
+          ? ZlibCompress(input, output, compressed_data_bound)
+          : LzCompress(input, output);
+  DCHECK_LE(compressed_data_size, compressed_data_bound);
 
   // Reallocating to exactly the size we need.
   snapshot_data.Resize(static_cast<uint32_t>(compressed_data_size) +
-                       sizeof(payload_length));
+                       kCompressedHeaderSize);
   DCHECK_EQ(payload_length,
             GetUncompressedSize(snapshot_data.RawData().begin()));
 
@@ -69,24 +445,24 @@ SnapshotData SnapshotCompression::Decompress(
   base::ElapsedTimer timer;
   if (v8_flags.profile_deserialization) timer.Start();
 
-  const Bytef* input_bytef =
-      reinterpret_cast<const Bytef*>(compressed_data.begin());
-
-  // Since we are doing raw compression (no zlib or gzip headers), we need to
-  // manually retrieve the uncompressed size.
-  uint32_t uncompressed_payload_length = GetUncompressedSize(input_bytef);
-  input_bytef += sizeof(uncompressed_payload_length);
+  CHECK_GE(compressed_data.size(), kCompressedHeaderSize);
+  const uint32_t uncompressed_payload_length =
+      GetUncompressedSize(compressed_data.begin());
+  const SnapshotCompressionCodec codec = GetCodec(compressed_data.begin());
+  const base::Vector<const uint8_t> input =
+      compressed_data.SubVector(kCompressedHeaderSize, compressed_data.size());
 
   snapshot_data.AllocateData(uncompressed_payload_length);
+  uint8_t* output = const_cast<uint8_t*>(snapshot_data.RawData().begin());
 
-  uLongf uncompressed_size = uncompressed_payload_length;
-  CHECK_EQ(zlib_internal::UncompressHelper(
-               zlib_internal::ZRAW,
-               const_cast<Bytef*>(snapshot_data.RawData().begin()),
-               &uncompressed_size, input_bytef,
-               static_cast<uLong>(compressed_data.size() -
-                                  sizeof(uncompressed_payload_length))),
-           Z_OK);
+  switch (codec) {
+    case SnapshotCompressionCodec::kZlib:
+      ZlibDecompress(input, output, uncompressed_payload_length);
+      break;
+    case SnapshotCompressionCodec::kLz:
+      LzDecompress(input, base::VectorOf(output, uncompressed_payload_length));
+      break;
+  }
 
   if (v8_flags.profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
@@ -5,18 +5,36 @@
 #ifndef V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
 #define V8_SNAPSHOT_SNAPSHOT_COMPRESSION_H_
 
+#include <optional>
+
 #include "src/base/vector.h"
 #include "src/snapshot/snapshot-data.h"
 
 namespace v8 {
 namespace internal {
 
+// The codec is recorded in the compressed data, so the decompressor handles
+// snapshots produced with any of them.
+enum class SnapshotCompressionCodec : uint32_t {
+  // Raw deflate.
+  kZlib = 0,
+  // Independently compressed 64 KiB blocks in an LZ77 byte format. Decompresses
+  // considerably faster than deflate, and in parallel.
+  kLz = 1,
+};
+
 class SnapshotCompression : public AllStatic {
  public:
+  // Compresses with the codec selected by --snapshot-compression-codec.
   V8_EXPORT_PRIVATE static SnapshotData Compress(
       const SnapshotData* uncompressed_data);
+  V8_EXPORT_PRIVATE static SnapshotData Compress(
+      const SnapshotData* uncompressed_data, SnapshotCompressionCodec codec);
   V8_EXPORT_PRIVATE static SnapshotData Decompress(
       base::Vector<const uint8_t> compressed_data);
+
+  V8_EXPORT_PRIVATE static std::optional<SnapshotCompressionCodec>
+  CodecFromString(const char* name);
 };
 
 }  // namespace internal
@@ -6,10 +6,13 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <unordered_set>
+
 #include "src/api/api-inl.h"  // For OpenHandle.
 #include "src/baseline/baseline-batch-compiler.h"
 #include "src/common/assert-scope.h"
 #include "src/execution/local-isolate-inl.h"
+#include "src/execution/tiering-manager.h"
 #include "src/handles/global-handles-inl.h"
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/read-only-promotion.h"
@@ -17,7 +20,10 @@
 #include "src/init/bootstrapper.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/runtime-call-stats-scope.h"
+#include "src/objects/hash-table-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/objects/keys.h"
+#include "src/objects/property-descriptor.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
 #include "src/snapshot/read-only-serializer.h"
@@ -218,19 +224,56 @@ MaybeDirectHandle<Context> Snapshot::NewContextFromSnapshot(
       embedder_fields_deserializer);
 }
 
+namespace {
+
+// Returns whether `fun` ran at least once. Without a feedback vector this
+// relies on the interrupt budget, which is consumed by returns and jumps.
+bool HasExecuted(Isolate* isolate, Tagged<JSFunction> fun) {
+  if (fun->has_feedback_vector()) return true;
+  if (!fun->has_closure_feedback_cell_array()) return false;
+  if (!fun->shared()->HasBytecodeArray()) return false;
+  return fun->raw_feedback_cell()->interrupt_budget() <
+         TieringManager::InterruptBudgetFor(isolate, fun, {});
+}
+
+}  // namespace
+
 // static
 void Snapshot::ClearReconstructableDataForSerialization(
-    Isolate* isolate, bool clear_recompilable_data) {
+    Isolate* isolate, bool clear_recompilable_data, bool keep_feedback) {
+  DCHECK_IMPLIES(keep_feedback, !clear_recompilable_data);
+  // When function code is kept, --snapshot-discard-unexecuted-code still
+  // discards the compiled data of functions that never ran, so that they are
+  // neither serialized nor deserialized. They are compiled lazily on first
+  // call.
+  const bool discard_unexecuted_code =
+      !clear_recompilable_data && v8_flags.snapshot_discard_unexecuted_code;
+
   // Clear SFIs and JSRegExps.
 
   {
     HandleScope scope(isolate);
     std::vector<i::Handle<i::SharedFunctionInfo>> sfis_to_clear;
     {
+      DisallowGarbageCollection no_gc;
+      std::unordered_set<Address> executed_sfis;
+      if (discard_unexecuted_code) {
+        i::HeapObjectIterator it(isolate->heap());
+        for (i::Tagged<i::HeapObject> o = it.Next(); !o.is_null();
+             o = it.Next()) {
+          if (!IsJSFunction(o)) continue;
+          i::Tagged<i::JSFunction> fun = i::Cast<i::JSFunction>(o);
+          if (HasExecuted(isolate, fun)) {
+            executed_sfis.insert(fun->shared().ptr());
+          }
+        }
+      }
+
       i::HeapObjectIterator it(isolate->heap());
       for (i::Tagged<i::HeapObject> o = it.Next(); !o.is_null();
            o = it.Next()) {
-        if (clear_recompilable_data && IsSharedFunctionInfo(o)) {
+        if ((clear_recompilable_data || discard_unexecuted_code) &&
+            IsSharedFunctionInfo(o)) {
           i::Tagged<i::SharedFunctionInfo> shared =
               i::Cast<i::SharedFunctionInfo>(o);
           if (IsScript(shared->script()) &&
@@ -238,6 +281,11 @@ void Snapshot::ClearReconstructableDataForSerialization(
                   Script::Type::kExtension) {
             continue;  // Don't clear extensions, they cannot be recompiled.
           }
+          if (discard_unexecuted_code &&
+              (!IsScript(shared->script()) ||
+               executed_sfis.contains(shared.ptr()))) {
+            continue;
+          }
           if (shared->CanDiscardCompiled()) {
             sfis_to_clear.emplace_back(shared, isolate);
           }
@@ -283,6 +331,10 @@ void Snapshot::ClearReconstructableDataForSerialization(
         continue;  // Don't clear extensions, they cannot be recompiled.
       }
 
+      // Functions that keep their feedback vector stay compiled. The context
+      // serializer resets their code to the bytecode.
+      if (keep_feedback && fun->has_feedback_vector()) continue;
+
       // Also, clear out feedback vectors and recompilable code.
       if (fun->CanDiscardCompiled(isolate)) {
         fun->UpdateCode(isolate, *BUILTIN_CODE(isolate, CompileLazy));
@@ -931,6 +983,9 @@ SnapshotCreatorImpl::~SnapshotCreatorImpl() {
     GlobalHandles::Destroy(contexts_[i].handle_location);
     contexts_[i].handle_location = nullptr;
   }
+  for (Address* location : immutable_object_roots_) {
+    GlobalHandles::Destroy(location);
+  }
   isolate_->Exit();
   if (owns_isolate_) Isolate::Delete(isolate_);
 }
@@ -997,6 +1052,56 @@ size_t SnapshotCreatorImpl::AddData(Address object) {
   return index;
 }
 
+Maybe<bool> SnapshotCreatorImpl::FreezeAndPrepareForPromotionToReadOnly(
+    DirectHandle<JSReceiver> object) {
+  DCHECK(!created());
+  // Freeze the graph of objects reachable through own data properties.
+  // Functions are neither frozen nor followed, since freezing them would
+  // also affect e.g. builtins that the data happens to reference.
+  // The worklist and the visited set grow inside the per-object handle scope
+  // below, so they are kept in handles of the outer scope that are patched.
+  HandleScope outer_scope(isolate_);
+  Handle<ArrayList> worklist =
+      indirect_handle(ArrayList::New(isolate_, 16), isolate_);
+  worklist.PatchValue(*ArrayList::Add(isolate_, worklist, object));
+  Handle<ObjectHashSet> visited = ObjectHashSet::New(isolate_, 16);
+  visited.PatchValue(*ObjectHashSet::Add(isolate_, visited, object));
+  for (int i = 0; i < worklist->length(); i++) {
+    HandleScope scope(isolate_);
+    DirectHandle<JSReceiver> receiver(Cast<JSReceiver>(worklist->get(i)),
+                                      isolate_);
+    MAYBE_RETURN(JSReceiver::SetIntegrityLevel(isolate_, receiver, FROZEN,
+                                               kThrowOnError),
+                 Nothing<bool>());
+    DirectHandle<FixedArray> keys;
+    ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+        isolate_, keys,
+        KeyAccumulator::GetKeys(isolate_, receiver, KeyCollectionMode::kOwnOnly,
+                                ALL_PROPERTIES,
+                                GetKeysConversion::kConvertToString),
+        Nothing<bool>());
+    for (int j = 0; j < keys->length(); j++) {
+      PropertyDescriptor descriptor;
+      Maybe<bool> found = JSReceiver::GetOwnPropertyDescriptor(
+          isolate_, receiver, direct_handle(keys->get(j), isolate_),
+          &descriptor);
+      MAYBE_RETURN(found, Nothing<bool>());
+      if (!found.FromJust() || !descriptor.has_value()) continue;
+      DirectHandle<JSAny> property_value = descriptor.value();
+      DirectHandle<JSReceiver> value;
+      if (!TryCast(property_value, &value) || IsJSFunction(*value) ||
+          visited->Has(isolate_, value)) {
+        continue;
+      }
+      visited.PatchValue(*ObjectHashSet::Add(isolate_, visited, value));
+      worklist.PatchValue(*ArrayList::Add(isolate_, worklist, value));
+    }
+  }
+  immutable_object_roots_.push_back(
+      isolate_->global_handles()->Create(*object).location());
+  return Just(true);
+}
+
 DirectHandle<NativeContext> SnapshotCreatorImpl::context_at(size_t i) const {
   return DirectHandle<NativeContext>::FromSlot(contexts_[i].handle_location);
 }
@@ -1085,9 +1190,14 @@ StartupData SnapshotCreatorImpl::CreateBlob(
     isolate_->heap()->CompactWeakArrayLists();
   }
 
+  const bool keep_feedback =
+      function_code_handling ==
+      SnapshotCreator::FunctionCodeHandling::kKeepWithFeedback;
+  if (keep_feedback) serializer_flags |= Snapshot::kKeepFeedback;
   Snapshot::ClearReconstructableDataForSerialization(
       isolate_,
-      function_code_handling == SnapshotCreator::FunctionCodeHandling::kClear);
+      function_code_handling == SnapshotCreator::FunctionCodeHandling::kClear,
+      keep_feedback);
 
   SafepointKind safepoint_kind = isolate_->has_shared_space()
                                      ? SafepointKind::kGlobal
@@ -1103,7 +1213,14 @@ StartupData SnapshotCreatorImpl::CreateBlob(
     // serialization. Objects can be promoted if a) they are themselves
     // immutable-after-deserialization and b) all objects in the transitive
     // object graph also satisfy condition a).
-    ReadOnlyPromotion::Promote(isolate_, safepoint_scope, no_gc_from_here_on);
+    std::vector<Tagged<JSReceiver>> immutable_object_roots;
+    immutable_object_roots.reserve(immutable_object_roots_.size());
+    for (Address* location : immutable_object_roots_) {
+      immutable_object_roots.push_back(
+          Cast<JSReceiver>(Tagged<Object>(*location)));
+    }
+    ReadOnlyPromotion::Promote(isolate_, safepoint_scope, no_gc_from_here_on,
+                               immutable_object_roots);
     // When creating the snapshot from scratch, we are responsible for sealing
     // the RO heap here. Note we cannot delegate the responsibility e.g. to
     // Isolate::Init since it should still be possible to allocate into RO
@@ -1112,6 +1229,11 @@ StartupData SnapshotCreatorImpl::CreateBlob(
     isolate_->read_only_heap()->OnCreateHeapObjectsComplete(isolate_);
   }
 
+  for (Address* location : immutable_object_roots_) {
+    GlobalHandles::Destroy(location);
+  }
+  immutable_object_roots_.clear();
+
   // Create a vector with all contexts and destroy associated global handles.
   // This is important because serialization visits active global handles as
   // roots, which we don't want for our internal SnapshotCreatorImpl-related
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "include/v8-array-buffer.h"  // For ArrayBuffer::Allocator.
+#include "include/v8-maybe.h"
 #include "include/v8-snapshot.h"  // For StartupData.
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
@@ -19,6 +20,7 @@ namespace internal {
 class Context;
 class Isolate;
 class JSGlobalProxy;
+class JSReceiver;
 class SafepointScope;
 class SnapshotData;
 
@@ -52,6 +54,10 @@ class Snapshot : public AllStatic {
     // objects are serialized, and the shared heap object cache is populated as
     // shared heap objects are serialized.
     kReconstructReadOnlyAndSharedObjectCachesForTesting = 1 << 2,
+    // If set, feedback vectors of compiled functions are serialized with
+    // their feedback instead of being cleared. Cached OSR code and pending
+    // tiering requests are still dropped.
+    kKeepFeedback = 1 << 3,
   };
   using SerializerFlags = base::Flags<SerializerFlag>;
   V8_EXPORT_PRIVATE static constexpr SerializerFlags kDefaultSerializerFlags =
@@ -60,9 +66,11 @@ class Snapshot : public AllStatic {
   // In preparation for serialization, clear data from the given isolate's heap
   // that 1. can be reconstructed and 2. is not suitable for serialization. The
   // `clear_recompilable_data` flag controls whether compiled objects are
-  // cleared from shared function infos and regexp objects.
+  // cleared from shared function infos and regexp objects. With
+  // `keep_feedback`, compiled functions keep their feedback vectors.
   V8_EXPORT_PRIVATE static void ClearReconstructableDataForSerialization(
-      Isolate* isolate, bool clear_recompilable_data);
+      Isolate* isolate, bool clear_recompilable_data,
+      bool keep_feedback = false);
 
   // Serializes the given isolate and contexts. Each context may have an
   // associated callback to serialize internal fields. The default context must
@@ -176,6 +184,9 @@ class SnapshotCreatorImpl final {
   size_t AddData(DirectHandle<NativeContext> context, Address object);
   size_t AddData(Address object);
 
+  Maybe<bool> FreezeAndPrepareForPromotionToReadOnly(
+      DirectHandle<JSReceiver> object);
+
   StartupData CreateBlob(
       SnapshotCreator::FunctionCodeHandling function_code_handling,
       Snapshot::SerializerFlags serializer_flags =
@@ -208,6 +219,9 @@ class SnapshotCreatorImpl final {
   Isolate* const isolate_;
   std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
   std::vector<SerializableContext> contexts_;
+  // Global handles to the roots of object graphs that are promoted to RO
+  // space when the blob is created.
+  std::vector<Address*> immutable_object_roots_;
 };
 
 }  // namespace internal
@@ -13,6 +13,7 @@
 #include "src/base/logging.h"
 #include "src/base/page-allocator.h"
 #include "src/base/platform/memory.h"
+#include "src/base/platform/platform.h"
 #include "src/base/sanitizer/lsan-page-allocator.h"
 #include "src/base/sanitizer/lsan-virtual-address-space.h"
 #include "src/base/virtual-address-space.h"
@@ -367,6 +368,13 @@ bool VirtualMemoryCage::InitReservation(
       params.reservation_size - (allocatable_base - base_), params.page_size);
   size_ = allocatable_base + allocatable_size - base_;
 
+  if (params.use_huge_pages) {
+    // This is only a hint. Chunks are advised again when they are allocated as
+    // decommitting memory may drop the hint.
+    USE(base::OS::AdviseHugePages(reinterpret_cast<void*>(allocatable_base),
+                                  allocatable_size, true));
+  }
+
   page_allocator_ = std::make_unique<base::BoundedPageAllocator>(
       params.page_allocator, allocatable_base, allocatable_size,
       params.page_size, params.page_initialization_mode,
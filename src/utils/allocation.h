@@ -395,6 +395,8 @@ class VirtualMemoryCage {
     PageAllocator::Permission permissions;
     base::PageInitializationMode page_initialization_mode;
     base::PageFreeingMode page_freeing_mode;
+    // Whether the reservation should be backed by transparent huge pages.
+    bool use_huge_pages = false;
 
     static constexpr size_t kAnyBaseAlignment = 1;
   };
@@ -4,13 +4,29 @@
 
 #include "test/benchmarks/cpp/benchmark-utils.h"
 
+#include <vector>
+
 #include "include/cppgc/platform.h"
 #include "include/libplatform/libplatform.h"
 #include "include/v8-array-buffer.h"
 #include "include/v8-cppgc.h"
 #include "include/v8-initialization.h"
+
 namespace v8::benchmarking {
 
+namespace {
+
+std::vector<const char*>& RegisteredProcessFlags() {
+  static std::vector<const char*> flags;
+  return flags;
+}
+
+}  // namespace
+
+ProcessFlags::ProcessFlags(const char* flags) {
+  RegisteredProcessFlags().push_back(flags);
+}
+
 // static
 v8::Platform* BenchmarkWithIsolate::platform_;
 
@@ -23,6 +39,9 @@ v8::ArrayBuffer::Allocator* BenchmarkWithIsolate::v8_ab_allocator_;
 // static
 void BenchmarkWithIsolate::InitializeProcess() {
   v8::V8::SetFlagsFromString("--allow-natives-syntax");
+  for (const char* flags : RegisteredProcessFlags()) {
+    v8::V8::SetFlagsFromString(flags);
+  }
   platform_ = v8::platform::NewDefaultPlatform().release();
   v8::V8::InitializePlatform(platform_);
   v8::V8::Initialize();
@@ -17,6 +17,16 @@ static constexpr uint16_t kEmbedderId = 0;
 static constexpr size_t kTypeOffset = 0;
 static constexpr size_t kInstanceOffset = 1;
 
+// Registers V8 flags that are set by BenchmarkWithIsolate::InitializeProcess()
+// before V8 is initialized, for benchmarks that rely on flags which can't be
+// changed later on. Instances are meant to be defined at namespace scope:
+//
+//   const v8::benchmarking::ProcessFlags kFlags("--expose-gc");
+class ProcessFlags {
+ public:
+  explicit ProcessFlags(const char* flags);
+};
+
 // BenchmarkWithIsolate is a basic benchmark fixture that sets up the process
 // with a single Isolate.
 class BenchmarkWithIsolate : public benchmark::Fixture {
@@ -29,6 +39,10 @@ class BenchmarkWithIsolate : public benchmark::Fixture {
   V8_INLINE cppgc::AllocationHandle& allocation_handle() {
     return v8_isolate_->GetCppHeap()->GetAllocationHandle();
   }
+  // For benchmarks that create Isolates of their own.
+  V8_INLINE v8::ArrayBuffer::Allocator* array_buffer_allocator() {
+    return v8_ab_allocator_;
+  }
 
  private:
   static v8::Platform* platform_;
@@ -0,0 +1,75 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures how scavenges of a single, wide object graph scale with the number
+// of parallel scavenge tasks. All objects hang off a single large array which
+// is the worst case for scavenger load balancing.
+
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr int kGraphSize = 200000;
+
+// Flags are changed between benchmark runs. The young generation is sized
+// such that building the graph does not trigger scavenges on its own.
+const v8::benchmarking::ProcessFlags kFlags(
+    "--no-freeze-flags-after-init --expose-gc --min-semi-space-size=64 "
+    "--max-semi-space-size=64");
+
+void RunScript(v8::Local<v8::Context> context, const std::string& source) {
+  v8::Local<v8::String> v8_source =
+      v8::String::NewFromUtf8(context->GetIsolate(), source.c_str())
+          .ToLocalChecked();
+  v8::Script::Compile(context, v8_source)
+      .ToLocalChecked()
+      ->Run(context)
+      .ToLocalChecked();
+}
+
+class Scavenger : public v8::benchmarking::BenchmarkWithIsolate {};
+
+// Arguments: maximum number of scavenge tasks, whether to split large arrays.
+BENCHMARK_DEFINE_F(Scavenger, SingleRootGraph)(benchmark::State& state) {
+  const std::string flags =
+      "--scavenger-max-tasks=" + std::to_string(state.range(0)) +
+      (state.range(1) ? " --scavenger-split-large-arrays"
+                      : " --no-scavenger-split-large-arrays");
+  v8::V8::SetFlagsFromString(flags.c_str());
+
+  v8::Isolate* isolate = v8_isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  const std::string build_graph =
+      "globalThis.root = new Array(" + std::to_string(kGraphSize) +
+      ");"
+      "for (let i = 0; i < root.length; i++) root[i] = {a: i, b: [i]};";
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    RunScript(context, build_graph);
+    state.ResumeTiming();
+    isolate->RequestGarbageCollectionForTesting(
+        v8::Isolate::kMinorGarbageCollection);
+  }
+  RunScript(context, "globalThis.root = undefined;");
+}
+
+BENCHMARK_REGISTER_F(Scavenger, SingleRootGraph)
+    ->ArgsProduct({{1, 2, 4, 8, 16}, {0, 1}})
+    ->ArgNames({"tasks", "split"})
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,101 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures isolate creation from snapshots compressed with each codec of
+// --snapshot-compression-codec. Without snapshot compression in the build
+// (v8_enable_snapshot_compression) all variants measure the same thing.
+
+#include <iterator>
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-initialization.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-snapshot.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+constexpr const char* kCodecs[] = {"zlib", "lz"};
+
+// The codec flag is changed while creating the snapshots.
+const v8::benchmarking::ProcessFlags kFlags("--no-freeze-flags-after-init");
+
+class SnapshotCompression : public v8::benchmarking::BenchmarkWithIsolate {
+ public:
+  // Arguments: index into kCodecs.
+  void SetUp(::benchmark::State& state) override {
+    blob_ = CreateBlob(kCodecs[state.range(0)]);
+  }
+
+  void TearDown(::benchmark::State& state) override { delete[] blob_.data; }
+
+ protected:
+  v8::StartupData* blob() { return &blob_; }
+
+ private:
+  // Creates a snapshot whose default context holds a sizable object graph,
+  // the way embedder snapshots do.
+  v8::StartupData CreateBlob(const char* codec) {
+    const std::string flags =
+        std::string("--snapshot-compression-codec=") + codec;
+    v8::V8::SetFlagsFromString(flags.c_str());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = array_buffer_allocator();
+    v8::SnapshotCreator creator(create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::String> source = v8::String::NewFromUtf8Literal(
+          isolate,
+          "globalThis.data = [];"
+          "for (let i = 0; i < 50000; i++) {"
+          "  data.push({id: i, name: 'item' + i});"
+          "}");
+      v8::Script::Compile(context, source)
+          .ToLocalChecked()
+          ->Run(context)
+          .ToLocalChecked();
+      creator.SetDefaultContext(context);
+    }
+    return creator.CreateBlob(
+        v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+
+  v8::StartupData blob_;
+};
+
+BENCHMARK_DEFINE_F(SnapshotCompression, IsolateCreation)
+(benchmark::State& state) {
+  state.SetLabel(kCodecs[state.range(0)]);
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator();
+  create_params.snapshot_blob = blob();
+  for (auto _ : state) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      benchmark::DoNotOptimize(v8::Context::New(isolate));
+    }
+    state.PauseTiming();
+    isolate->Dispose();
+    state.ResumeTiming();
+  }
+  state.counters["blob_bytes"] = create_params.snapshot_blob->raw_size;
+}
+
+BENCHMARK_REGISTER_F(SnapshotCompression, IsolateCreation)
+    ->DenseRange(0, static_cast<int>(std::size(kCodecs)) - 1)
+    ->ArgName("codec")
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+}  // namespace
@@ -0,0 +1,61 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures isolate and context creation up to the first script compile, and
+// breaks the time down into the phases reported by
+// v8::Isolate::GetStartupStatistics.
+
+#include <map>
+#include <string>
+
+#include "include/v8-context.h"
+#include "include/v8-isolate.h"
+#include "include/v8-local-handle.h"
+#include "include/v8-primitive.h"
+#include "include/v8-script.h"
+#include "include/v8-statistics.h"
+#include "src/base/logging.h"
+#include "test/benchmarks/cpp/benchmark-utils.h"
+#include "third_party/google_benchmark_chrome/src/include/benchmark/benchmark.h"
+
+namespace {
+
+class StartupTimeline : public v8::benchmarking::BenchmarkWithIsolate {};
+
+BENCHMARK_DEFINE_F(StartupTimeline, FirstCompile)(benchmark::State& state) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = array_buffer_allocator();
+  std::map<std::string, double> phase_totals_ms;
+  for (auto _ : state) {
+    v8::Isolate* isolate = v8::Isolate::New(create_params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::String> source =
+          v8::String::NewFromUtf8Literal(isolate, "function f() {} f();");
+      benchmark::DoNotOptimize(v8::Script::Compile(context, source));
+    }
+    state.PauseTiming();
+    v8::StartupStatistics statistics;
+    CHECK(isolate->GetStartupStatistics(&statistics));
+    for (size_t i = 0; i < statistics.phase_count(); i++) {
+      phase_totals_ms[statistics.phase_name(i)] +=
+          statistics.phase_duration_ms(i);
+    }
+    isolate->Dispose();
+    state.ResumeTiming();
+  }
+  for (const auto& [name, total_ms] : phase_totals_ms) {
+    state.counters[name] =
+        benchmark::Counter(total_ms, benchmark::Counter::kAvgIterations);
+  }
+}
+
+BENCHMARK_REGISTER_F(StartupTimeline, FirstCompile)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+}  // namespace
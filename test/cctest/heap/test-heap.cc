@@ -2018,6 +2018,36 @@ TEST(MapRetaining) {
   CheckMapRetainingFor(7);
 }
 
+TEST(ShapeCompactionDropsRetainedDeprecatedMaps) {
+  if (!v8_flags.incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  v8_flags.shape_compaction = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  v8::Local<v8::Context> ctx = v8::Context::New(CcTest::isolate());
+  DirectHandle<Context> context = Utils::OpenDirectHandle(*ctx);
+  CHECK(IsNativeContext(*context));
+  DirectHandle<NativeContext> native_context = Cast<NativeContext>(context);
+
+  ctx->Enter();
+  DirectHandle<WeakFixedArray> array_with_map =
+      AddRetainedMap(isolate, native_context);
+  CHECK(array_with_map->get(0).IsWeak());
+  Cast<Map>(array_with_map->get(0).GetHeapObjectAssumeWeak())
+      ->set_is_deprecated(true);
+  {
+    // The map would be retained for v8_flags.retain_maps_for_n_gc cycles if
+    // it was not deprecated.
+    heap::SimulateIncrementalMarking(heap);
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+    heap::InvokeMajorGC(heap);
+  }
+  CHECK(array_with_map->get(0).IsCleared());
+  ctx->Exit();
+}
+
 TEST(RetainedMapsCleanup) {
   if (!v8_flags.incremental_marking) return;
   ManualGCScope manual_gc_scope;
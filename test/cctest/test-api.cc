@@ -13614,6 +13614,47 @@ UNINITIALIZED_TEST(TwoIsolateGroups) {
   TestAllocateAndNewForTwoIsolateGroups(create_params_1, create_params_2,
                                         groups[0], groups[1]);
 }
+
+#if V8_OS_LINUX
+UNINITIALIZED_TEST(TwoIsolateGroupsShareReadOnlyPages) {
+  if (!v8::IsolateGroup::CanCreateNewGroups()) return;
+  FLAG_SCOPE(share_read_only_pages_across_isolate_groups);
+
+  v8::IsolateGroup group1 = v8::IsolateGroup::Create();
+  v8::IsolateGroup group2 = v8::IsolateGroup::Create();
+  v8::Isolate::CreateParams create_params_1;
+  create_params_1.array_buffer_allocator =
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator(group1);
+  v8::Isolate::CreateParams create_params_2;
+  create_params_2.array_buffer_allocator =
+      v8::ArrayBuffer::Allocator::NewDefaultAllocator(group2);
+
+  v8::Isolate* isolate1 = v8::Isolate::New(group1, create_params_1);
+  v8::Isolate* isolate2 = v8::Isolate::New(group2, create_params_2);
+  i::IsolateGroup* i_group1 =
+      reinterpret_cast<i::Isolate*>(isolate1)->isolate_group();
+  i::IsolateGroup* i_group2 =
+      reinterpret_cast<i::Isolate*>(isolate2)->isolate_group();
+  // Nothing is shared if the OS does not support shared memory objects.
+  if (i_group1->shared_read_only_page_bytes() > 0) {
+    CHECK_GT(i_group2->shared_read_only_page_bytes(), 0u);
+  }
+
+  // Read-only objects are still intact in both groups.
+  for (v8::Isolate* isolate : {isolate1, isolate2}) {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CHECK_EQ(3, CompileRun("'abc'.length")->Int32Value(context).FromJust());
+  }
+
+  isolate2->Dispose();
+  isolate1->Dispose();
+  delete create_params_2.array_buffer_allocator;
+  delete create_params_1.array_buffer_allocator;
+}
+#endif  // V8_OS_LINUX
 #endif  // defined(V8_COMPRESS_POINTERS) && \
         // !defined(V8_COMPRESS_POINTERS_IN_SHARED_CAGE)
 
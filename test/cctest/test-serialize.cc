@@ -28,6 +28,8 @@
 #include <signal.h>
 #include <sys/stat.h>
 
+#include <map>
+#include <string>
 #include <vector>
 
 #include "include/cppgc/allocation.h"
@@ -1807,6 +1809,104 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlobWithKeep) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(CustomSnapshotDataBlobDiscardUnexecutedCode) {
+  i::v8_flags.snapshot_discard_unexecuted_code = true;
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::String> source_str = v8_str(
+          "function f() { return 1; }\n"
+          "function g() { return 2; }\n"
+          "f();");
+      v8::ScriptOrigin origin(v8_str("test"));
+      v8::ScriptCompiler::Source source(source_str, origin);
+      CompileRun(isolate->GetCurrentContext(), &source,
+                 v8::ScriptCompiler::kEagerCompile);
+      CHECK(IsCompiled("f"));
+      CHECK(IsCompiled("g"));
+      creator.SetDefaultContext(context);
+    }
+    blob = creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CHECK(IsCompiled("f"));
+      CHECK(!IsCompiled("g"));
+      ExpectInt32("g()", 2);
+      CHECK(IsCompiled("g"));
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
+UNINITIALIZED_TEST(CustomSnapshotDataBlobWithKeepFeedback) {
+  i::v8_flags.lazy_feedback_allocation = false;
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "function getX(o) { return o.x; }\n"
+          "for (let i = 0; i < 100; i++) getX({x: i});");
+      creator.SetDefaultContext(context);
+    }
+    blob = creator.CreateBlob(
+        v8::SnapshotCreator::FunctionCodeHandling::kKeepWithFeedback);
+  }
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+      DirectHandle<JSFunction> fun = Cast<JSFunction>(
+          v8::Utils::OpenDirectHandle(*CompileRun("getX")));
+      CHECK(fun->is_compiled(i_isolate));
+      CHECK(fun->has_feedback_vector());
+      Tagged<FeedbackVector> vector = fun->feedback_vector();
+      CHECK_GE(vector->invocation_count(), 100);
+      FeedbackNexus nexus(i_isolate, vector, FeedbackSlot(0));
+      CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
+      ExpectInt32("getX({x: 42})", 42);
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(CustomSnapshotDataBlobImmortalImmovableRoots) {
   // Flood the startup snapshot with shared function infos. If they are
   // serialized before the immortal immovable root, the root will no longer end
@@ -3382,10 +3482,90 @@ TEST(CodeSerializerFlagChange) {
         isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
         .ToLocalChecked();
     CHECK(cache->rejected);
+
+    v8::CodeCacheStatistics statistics;
+    CHECK(isolate2->GetCodeCacheStatistics(&statistics));
+    CHECK_EQ(0u, statistics.accepted_count());
+    CHECK_EQ(1u, statistics.rejected_count(
+                     v8::ScriptCompiler::CachedData::kFlagsMismatch));
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerIrrelevantFlagChange) {
+  const char* js_source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(js_source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+
+  // Tracing flags cannot change the cached data.
+  v8_flags.trace_deopt = true;
+  FlagList::EnforceFlagImplications();
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(js_source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK(result->ToString(isolate2->GetCurrentContext())
+              .ToLocalChecked()
+              ->Equals(isolate2->GetCurrentContext(), v8_str("abcdef"))
+              .FromJust());
+
+    v8::CodeCacheStatistics statistics;
+    CHECK(isolate2->GetCodeCacheStatistics(&statistics));
+    CHECK_EQ(1u, statistics.accepted_count());
+    CHECK_EQ(1u, statistics.accepted_with_flags_mismatch_count());
   }
   isolate2->Dispose();
 }
 
+TEST(StartupStatistics) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    // Only the first script compile is part of startup.
+    v8::Script::Compile(context, v8_str("1 + 1")).ToLocalChecked();
+    v8::Script::Compile(context, v8_str("2 + 2")).ToLocalChecked();
+
+    v8::StartupStatistics statistics;
+    CHECK(isolate->GetStartupStatistics(&statistics));
+    std::map<std::string, int> counts;
+    for (size_t i = 0; i < statistics.phase_count(); i++) {
+      CHECK_GE(statistics.phase_start_ms(i), 0);
+      CHECK_GE(statistics.phase_duration_ms(i), 0);
+      counts[statistics.phase_name(i)]++;
+    }
+    CHECK_NULL(statistics.phase_name(statistics.phase_count()));
+    CHECK_GE(counts["V8.StartupEmbeddedBlobSetup"], 1);
+    CHECK_EQ(1, counts["V8.StartupReadOnlyHeapSetup"]);
+    CHECK_EQ(1, counts["V8.StartupDeserialization"]);
+    CHECK_GE(counts["V8.StartupContextDeserialization"], 1);
+    CHECK_EQ(counts["V8.StartupContextDeserialization"],
+             counts["V8.StartupEmbedderFieldCallbacks"]);
+    CHECK_EQ(1, counts["V8.StartupFirstScriptCompile"]);
+  }
+  isolate->Dispose();
+}
+
 TEST(CachedDataCompatibilityCheck) {
   {
     v8::Isolate::CreateParams create_params;
@@ -4045,6 +4225,66 @@ UNINITIALIZED_TEST(SnapshotCreatorNoExternalReferencesDefault) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(SnapshotCreatorPromotesFrozenData) {
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "var table = { primes: [2, 3, 5, 7.5], nested: { squares: [1, 4] },"
+          "              objects: [{}] };"
+          "var mutable = [1, 2, 3];");
+      v8::Local<v8::Object> table = CompileRun("table").As<v8::Object>();
+      CHECK(creator.FreezeAndPrepareForPromotionToReadOnly(context, table)
+                .FromJust());
+      ExpectTrue("Object.isFrozen(table.nested.squares)");
+      ExpectFalse("Object.isFrozen(mutable)");
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+  }
+
+  {
+    v8::Isolate::CreateParams params;
+    params.snapshot_blob = &blob;
+    params.array_buffer_allocator = CcTest::array_buffer_allocator();
+    // Test-appropriate equivalent of v8::Isolate::New.
+    v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      auto elements_of = [](const char* source) {
+        return Cast<i::JSObject>(Utils::OpenHandle(*CompileRun(source)))
+            ->elements();
+      };
+      // Elements with numbers only are promoted, including nested ones.
+      CHECK(HeapLayout::InReadOnlySpace(elements_of("table.primes")));
+      CHECK(HeapLayout::InReadOnlySpace(elements_of("table.nested.squares")));
+      // Elements that point into the mutable heap stay where they are.
+      CHECK(!HeapLayout::InReadOnlySpace(elements_of("table.objects")));
+      CHECK(!HeapLayout::InReadOnlySpace(elements_of("mutable")));
+
+      ExpectTrue("table.primes[3] === 7.5");
+      ExpectInt32("table.primes[0] = 11; table.primes[0]", 2);
+      ExpectInt32("mutable[0] = 11; mutable[0]", 11);
+      heap::InvokeMajorGC(reinterpret_cast<i::Isolate*>(isolate)->heap());
+      ExpectInt32("table.nested.squares[1]", 4);
+    }
+    isolate->Dispose();
+  }
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 v8::StartupData CreateCustomSnapshotWithPreparseDataAndNoOuterScope() {
   SnapshotCreatorParams testing_params;
   v8::SnapshotCreator creator(testing_params.create_params);
@@ -5660,6 +5900,67 @@ UNINITIALIZED_TEST(ReinitializeHashSeedRehashable) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(ReinitializeHashSeedParallelStringHashing) {
+  i::v8_flags.rehash_snapshot = true;
+  i::v8_flags.parallel_snapshot_string_hashing = true;
+  i::v8_flags.hash_seed = 42;
+  i::v8_flags.allow_natives_syntax = true;
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    SnapshotCreatorParams testing_params;
+    v8::SnapshotCreator creator(testing_params.create_params);
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      // Enough strings to hash them on worker threads after deserialization.
+      CompileRun(
+          "var o = {};"
+          "%OptimizeObjectForAddingMultipleProperties(o, 10000);"
+          "var values = [];"
+          "for (var i = 0; i < 10000; i++) {"
+          "  o['key' + i] = i;"
+          "  values.push('value' + i);"
+          "}");
+      i::DirectHandle<i::Object> i_o =
+          v8::Utils::OpenDirectHandle(*CompileRun("o"));
+      CHECK(!i::Cast<i::JSObject>(i_o)->HasFastProperties());
+      ExpectInt32("o.key7331", 7331);
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+    CHECK(blob.CanBeRehashed());
+  }
+
+  i::v8_flags.hash_seed = 1337;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.snapshot_blob = &blob;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    CHECK_EQ(static_cast<uint64_t>(1337),
+             HashSeed(reinterpret_cast<i::Isolate*>(isolate)).seed());
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    CHECK(!context.IsEmpty());
+    v8::Context::Scope context_scope(context);
+    i::DirectHandle<i::Object> i_o =
+        v8::Utils::OpenDirectHandle(*CompileRun("o"));
+    CHECK(!i::Cast<i::JSObject>(i_o)->HasFastProperties());
+    ExpectInt32("o.key7331", 7331);
+    ExpectInt32("o['key' + 9999]", 9999);
+    ExpectTrue("values.indexOf('value' + 4242) === 4242");
+    ExpectTrue("new Set(values).has('value' + 17)");
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(ClassFields) {
   i::v8_flags.rehash_snapshot = true;
   i::v8_flags.hash_seed = 42;
@@ -0,0 +1,128 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Simple indexed loops, whose map checks, length loads and bounds checks are
+// loop invariant or provably in bounds.
+
+new BenchmarkSuite('TypedArraySum', [1000], [
+  new Benchmark('TypedArraySum', false, false, 0, TypedArraySum, Setup)
+]);
+
+new BenchmarkSuite('TypedArrayScale', [1000], [
+  new Benchmark('TypedArrayScale', false, false, 0, TypedArrayScale, Setup)
+]);
+
+new BenchmarkSuite('PackedSmiArraySum', [1000], [
+  new Benchmark('PackedSmiArraySum', false, false, 0, PackedSmiArraySum,
+                Setup)
+]);
+
+new BenchmarkSuite('PackedDoubleArraySum', [1000], [
+  new Benchmark('PackedDoubleArraySum', false, false, 0, PackedDoubleArraySum,
+                Setup)
+]);
+
+new BenchmarkSuite('InvariantFieldLoad', [1000], [
+  new Benchmark('InvariantFieldLoad', false, false, 0, InvariantFieldLoad,
+                Setup)
+]);
+
+// ----------------------------------------------------------------------------
+
+const kLength = 1000;
+
+let int32Array;
+let float64Array;
+let smiArray;
+let doubleArray;
+let config;
+
+function Setup() {
+  int32Array = new Int32Array(kLength);
+  float64Array = new Float64Array(kLength);
+  smiArray = [];
+  doubleArray = [];
+  for (let i = 0; i < kLength; i++) {
+    int32Array[i] = i;
+    float64Array[i] = i + 0.5;
+    smiArray.push(i);
+    doubleArray.push(i + 0.5);
+  }
+  config = {scale: 3, offset: 1};
+}
+
+function SumTypedArray(a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+function ScaleTypedArray(a, factor) {
+  for (let i = 0; i < a.length; i++) {
+    a[i] = a[i] * factor;
+  }
+}
+
+function SumArray(a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+// A separate copy, so that the elements kind feedback stays monomorphic.
+function SumDoubleArray(a) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i];
+  }
+  return sum;
+}
+
+function SumArrayWith(a, c) {
+  let sum = 0;
+  for (let i = 0; i < a.length; i++) {
+    sum += a[i] * c.scale + c.offset;
+  }
+  return sum;
+}
+
+function TypedArraySum() {
+  const expected = kLength * (kLength - 1) / 2;
+  if (SumTypedArray(int32Array) !== expected) {
+    throw new Error('TypedArraySum: wrong result');
+  }
+}
+
+function TypedArrayScale() {
+  ScaleTypedArray(float64Array, 2);
+  ScaleTypedArray(float64Array, 0.5);
+  if (float64Array[kLength - 1] !== kLength - 0.5) {
+    throw new Error('TypedArrayScale: wrong result');
+  }
+}
+
+function PackedSmiArraySum() {
+  const expected = kLength * (kLength - 1) / 2;
+  if (SumArray(smiArray) !== expected) {
+    throw new Error('PackedSmiArraySum: wrong result');
+  }
+}
+
+function PackedDoubleArraySum() {
+  const expected = kLength * kLength / 2;
+  if (SumDoubleArray(doubleArray) !== expected) {
+    throw new Error('PackedDoubleArraySum: wrong result');
+  }
+}
+
+function InvariantFieldLoad() {
+  const expected = 3 * kLength * (kLength - 1) / 2 + kLength;
+  if (SumArrayWith(smiArray, config) !== expected) {
+    throw new Error('InvariantFieldLoad: wrong result');
+  }
+}
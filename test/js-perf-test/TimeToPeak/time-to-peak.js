@@ -0,0 +1,98 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Every iteration compiles a fresh copy of the same kernel and runs it a fixed
+// number of times, so the score reflects how quickly the kernel reaches its
+// peak tier rather than the peak performance itself. The variants differ only
+// in the feedback the kernel sees.
+
+new BenchmarkSuite('Monomorphic', [1000], [
+  new Benchmark('Monomorphic', false, false, 0, Monomorphic, Setup)
+]);
+
+new BenchmarkSuite('Polymorphic', [1000], [
+  new Benchmark('Polymorphic', false, false, 0, Polymorphic, Setup)
+]);
+
+new BenchmarkSuite('Unstable', [1000], [
+  new Benchmark('Unstable', false, false, 0, Unstable, Setup)
+]);
+
+// ----------------------------------------------------------------------------
+
+const kCalls = 400;
+const kPoints = 64;
+
+const kKernelSource = `
+  let sum = 0;
+  for (let i = 0; i < points.length; i++) {
+    const p = points[i];
+    sum += p.x * p.x + p.y * p.y;
+  }
+  return sum;
+`;
+
+let kernelId = 0;
+let monomorphicPoints;
+let polymorphicPoints;
+let doublePoints;
+
+// The unique comment defeats the compilation cache, so that every kernel
+// starts out in the interpreter with an empty feedback vector.
+function NewKernel() {
+  return new Function('points', `${kKernelSource} // ${kernelId++}`);
+}
+
+function MakePoints(make) {
+  const points = [];
+  for (let i = 0; i < kPoints; i++) points.push(make(i));
+  return points;
+}
+
+function Setup() {
+  monomorphicPoints = MakePoints(i => ({x: i, y: i + 1}));
+  polymorphicPoints = MakePoints(i => {
+    switch (i % 4) {
+      case 0: return {x: i, y: i + 1};
+      case 1: return {y: i + 1, x: i};
+      case 2: return {x: i, y: i + 1, z: 0};
+      case 3: return {w: 0, x: i, y: i + 1};
+    }
+  });
+  doublePoints = MakePoints(i => ({x: i + 0.5, y: i + 1.5, z: 0}));
+}
+
+function Run(kernel, points) {
+  let result = 0;
+  for (let i = 0; i < kCalls; i++) result = kernel(points);
+  return result;
+}
+
+function Check(actual, expected) {
+  if (actual !== expected) throw new Error(`Expected ${expected}, got ${actual}`);
+}
+
+const kIntegerSum = (() => {
+  let sum = 0;
+  for (let i = 0; i < kPoints; i++) sum += i * i + (i + 1) * (i + 1);
+  return sum;
+})();
+
+function Monomorphic() {
+  Check(Run(NewKernel(), monomorphicPoints), kIntegerSum);
+}
+
+function Polymorphic() {
+  Check(Run(NewKernel(), polymorphicPoints), kIntegerSum);
+}
+
+// The feedback of the kernel keeps changing during the first half of the run:
+// the points change shape and representation before settling.
+function Unstable() {
+  const kernel = NewKernel();
+  for (let i = 0; i < kCalls / 8; i++) kernel(monomorphicPoints);
+  for (let i = 0; i < kCalls / 8; i++) kernel(polymorphicPoints);
+  for (let i = 0; i < kCalls / 4; i++) kernel(doublePoints);
+  Check(Run(kernel, monomorphicPoints), kIntegerSum);
+}
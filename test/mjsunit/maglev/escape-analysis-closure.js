@@ -0,0 +1,66 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-escape-analysis
+// Flags: --maglev-inline-closure-allocation --no-always-turbofan
+
+function apply(f, x) {
+  return f(x);
+}
+
+// Arrow functions don't have a prototype slot.
+function arrow(x, deopt) {
+  let y = x + 1;
+  let add = (z) => z + y;
+  let r = apply(add, x);
+  if (deopt) {
+    // No feedback: deopts here and materializes {add}.
+    return add(r) + add.length;
+  }
+  return r;
+}
+
+// Sloppy function expressions do.
+function sloppy(x, deopt) {
+  let y = x + 1;
+  let add = function(z) { return z + y; };
+  let r = apply(add, x);
+  if (deopt) {
+    return add(r) + add.prototype.constructor(1);
+  }
+  return r;
+}
+
+for (let f of [arrow, sloppy]) {
+  %PrepareFunctionForOptimization(apply);
+  %PrepareFunctionForOptimization(f);
+  // Create a few closures, so that their feedback cell sees many closures.
+  assertEquals(3, f(1, false));
+  assertEquals(5, f(2, false));
+  %OptimizeMaglevOnNextCall(f);
+  assertEquals(7, f(3, false));
+  assertTrue(isMaglevved(f));
+  assertEquals(9, f(4, false));
+}
+
+assertEquals(5 + 1, arrow(1, true));
+assertFalse(isMaglevved(arrow));
+assertEquals(5 + 3, sloppy(1, true));
+assertFalse(isMaglevved(sloppy));
+
+// A closure that escapes is still allocated.
+function escape(x) {
+  return () => x;
+}
+%PrepareFunctionForOptimization(escape);
+escape(1);
+escape(2);
+%OptimizeMaglevOnNextCall(escape);
+let closures = [escape(3), escape(4)];
+assertTrue(isMaglevved(escape));
+assertEquals(3, closures[0]());
+assertEquals(4, closures[1]());
+assertNotSame(closures[0], closures[1]);
+assertEquals('function', typeof closures[0]);
+assertEquals('', escape(5).name);
@@ -0,0 +1,81 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --no-always-turbofan
+// Flags: --maglev-licm --maglev-bounds-check-elimination
+
+(function testTypedArraySum() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      s += a[i];
+    }
+    return s;
+  }
+
+  const ta = new Int32Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(ta));
+  %OptimizeMaglevOnNextCall(sum);
+  assertEquals(10, sum(ta));
+  assertTrue(isMaglevved(sum));
+  assertEquals(0, sum(new Int32Array(0)));
+  assertEquals(6, sum(new Int32Array([1, 2, 3])));
+})();
+
+(function testTypedArrayOffByOne() {
+  // The loop condition doesn't prove the access in bounds.
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i <= a.length; i++) {
+      s += a[i] | 0;
+    }
+    return s;
+  }
+
+  const ta = new Int32Array([1, 2, 3, 4]);
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(10, sum(ta));
+  %OptimizeMaglevOnNextCall(sum);
+  assertEquals(10, sum(ta));
+})();
+
+(function testPackedArrayShrinking() {
+  // Array lengths written in the loop can't be hoisted.
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      s += a[i];
+      if (s > 5) a.length = 2;
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(6, sum([1, 2, 3, 4]));
+  %OptimizeMaglevOnNextCall(sum);
+  assertEquals(6, sum([1, 2, 3, 4]));
+  assertEquals(3, sum([1, 2]));
+})();
+
+(function testInvariantLoadInBody() {
+  function sum(a, o) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) {
+      // Load o.scale first so that its map check precedes the bounds check.
+      s += o.scale * a[i];
+    }
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(sum);
+  assertEquals(20, sum([1, 2, 3, 4], {scale: 2}));
+  %OptimizeMaglevOnNextCall(sum);
+  assertEquals(20, sum([1, 2, 3, 4], {scale: 2}));
+  // Empty loops must not observe the hoisted checks.
+  assertEquals(0, sum([], {scale: 2}));
+  // A different map deopts in front of the loop.
+  assertEquals(30, sum([1, 2, 3, 4], {other: 0, scale: 3}));
+  assertEquals(10, sum([1, 2, 3, 4], {scale: 1}));
+})();
@@ -0,0 +1,35 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --turbofan --nomaglev --nosparkplug --allow-natives-syntax
+// Flags: --no-always-turbofan --no-profile-guided-optimization
+// Flags: --invocation-count-for-turbofan=10
+// Flags: --minimum-invocations-after-ic-update=10
+// Flags: --minimum-invocations-before-optimization=0
+// Flags: --tiering-cost-model --tiering-cost-model-max-scale=10
+
+// Functions with megamorphic feedback have their budget scaled by the maximum
+// scale after the last IC change. Without the cost model, the function below
+// would be optimized after about ten more calls.
+function megamorphic(o) {
+  return o.x + o.x;
+}
+
+const objects = [
+  {x: 1}, {x: 1, a: 0}, {x: 1, b: 0}, {x: 1, c: 0}, {x: 1, d: 0}, {x: 1, e: 0}
+];
+%EnsureFeedbackVectorForFunction(megamorphic);
+for (let i = 0; i < 40; i++) {
+  assertEquals(2, megamorphic(objects[i % objects.length]));
+}
+%FinalizeOptimization();
+assertUnoptimized(megamorphic);
+
+// Tier-up is only held back, the function is still optimized once the scaled
+// budget is used up.
+for (let i = 0; i < 200; i++) {
+  assertEquals(2, megamorphic(objects[i % objects.length]));
+}
+%FinalizeOptimization();
+assertOptimized(megamorphic);
@@ -0,0 +1,163 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --turboshaft-loop-vectorization
+
+function fill(a, n) {
+  for (let i = 0; i < n; i++) a[i] = (i * 7) % 13 - 6;
+  return a;
+}
+
+function optimize(f, ...args) {
+  %PrepareFunctionForOptimization(f);
+  f(...args);
+  f(...args);
+  %OptimizeFunctionOnNextCall(f);
+  return f(...args);
+}
+
+// Float64Array map. Lengths that are not a multiple of the number of lanes
+// are finished by the scalar loop.
+(function testFloat64Map() {
+  function scale(src, dst, k) {
+    for (let i = 0; i < src.length; i++) dst[i] = src[i] * k + 1.5;
+  }
+  for (let n of [0, 1, 2, 7, 64, 101]) {
+    let src = fill(new Float64Array(n), n);
+    let dst = new Float64Array(n);
+    optimize(scale, src, dst, 3);
+    for (let i = 0; i < n; i++) assertEquals(src[i] * 3 + 1.5, dst[i]);
+  }
+})();
+
+// Int32Array map with wrapping arithmetic.
+(function testInt32Map() {
+  function combine(a, b, c) {
+    for (let i = 0; i < a.length; i++) c[i] = ((a[i] ^ b[i]) + (a[i] << 3)) | 0;
+  }
+  for (let n of [3, 16, 33]) {
+    let a = fill(new Int32Array(n), n);
+    let b = fill(new Int32Array(n), n).reverse();
+    let c = new Int32Array(n);
+    optimize(combine, a, b, c);
+    for (let i = 0; i < n; i++) {
+      assertEquals(((a[i] ^ b[i]) + (a[i] << 3)) | 0, c[i]);
+    }
+  }
+})();
+
+// Integer sum reduction.
+(function testInt32Sum() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s = (s + a[i]) | 0;
+    return s;
+  }
+  for (let n of [0, 5, 64, 1001]) {
+    let a = fill(new Int32Array(n), n);
+    let expected = 0;
+    for (let i = 0; i < n; i++) expected = (expected + a[i]) | 0;
+    assertEquals(expected, optimize(sum, a));
+  }
+  let big = new Int32Array(9).fill(0x7fffffff);
+  assertEquals((0x7fffffff * 9) | 0, sum(big));
+})();
+
+// Math.max reduction, including NaN and -0.
+(function testFloat64Max() {
+  function max(a) {
+    let m = -Infinity;
+    for (let i = 0; i < a.length; i++) m = Math.max(m, a[i]);
+    return m;
+  }
+  let a = fill(new Float64Array(37), 37);
+  assertEquals(6, optimize(max, a));
+  assertEquals(-Infinity, max(new Float64Array(0)));
+  assertEquals(-0, max(new Float64Array([-0, -0, -0])));
+  assertEquals(0, max(new Float64Array([-0, 0, -0])));
+  assertEquals(NaN, max(new Float64Array([1, 2, NaN, 3, 4])));
+})();
+
+// Overlapping views of the same buffer must behave like the scalar loop.
+(function testOverlappingViews() {
+  function copy(src, dst) {
+    for (let i = 0; i < src.length; i++) dst[i] = src[i] + 1;
+  }
+  function reference(buffer, src_offset, dst_offset, n) {
+    let bytes = new Int32Array(buffer.slice(0));
+    let src = src_offset / 4, dst = dst_offset / 4;
+    for (let i = 0; i < n; i++) bytes[dst + i] = bytes[src + i] + 1;
+    return bytes;
+  }
+  for (let [src_offset, dst_offset] of [[0, 4], [4, 0], [0, 8], [0, 0],
+                                        [0, 64]]) {
+    let buffer = new ArrayBuffer(256);
+    fill(new Int32Array(buffer), 64);
+    let expected = reference(buffer, src_offset, dst_offset, 40);
+    %PrepareFunctionForOptimization(copy);
+    copy(new Int32Array(buffer, src_offset, 40),
+         new Int32Array(buffer, dst_offset, 40));
+    %OptimizeFunctionOnNextCall(copy);
+    let buffer2 = new ArrayBuffer(256);
+    fill(new Int32Array(buffer2), 64);
+    copy(new Int32Array(buffer2, src_offset, 40),
+         new Int32Array(buffer2, dst_offset, 40));
+    assertEquals(expected, new Int32Array(buffer2));
+  }
+})();
+
+// The loop bound doesn't depend on the array, so after detaching the buffer
+// the vector loop hands over to the scalar loop, which deopts on the first
+// out-of-bounds access.
+(function testDetach() {
+  function sum(a, n) {
+    let s = 0;
+    for (let i = 0; i < n; i++) s = (s + a[i]) | 0;
+    return s;
+  }
+  let a = new Int32Array(32).fill(1);
+  assertEquals(32, optimize(sum, a, 32));
+  assertOptimized(sum);
+  %ArrayBufferDetach(a.buffer);
+  assertEquals(0, sum(a, 32));
+})();
+
+// Shrinking a resizable buffer between optimized calls.
+(function testResizableShrink() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s = (s + a[i]) | 0;
+    return s;
+  }
+  function scale(src, dst, n) {
+    for (let i = 0; i < n; i++) dst[i] = src[i] * 2;
+  }
+  function expectedSum(a) {
+    let s = 0;
+    for (let x of a) s = (s + x) | 0;
+    return s;
+  }
+
+  // Length-tracking arrays see the new length in the loop condition.
+  let rab = new ArrayBuffer(64 * 4, {maxByteLength: 64 * 4});
+  let a = fill(new Int32Array(rab), 64);
+  assertEquals(expectedSum(a), optimize(sum, a));
+  for (let n of [37, 4, 3, 0]) {
+    rab.resize(n * 4);
+    assertEquals(n, a.length);
+    assertEquals(expectedSum(a), sum(a));
+  }
+
+  // With a fixed bound, the vector loop stops before the lanes that are out of
+  // bounds now, and the scalar loop finishes the iteration from there.
+  let src_rab = new ArrayBuffer(64 * 8, {maxByteLength: 64 * 8});
+  let src = fill(new Float64Array(src_rab), 64);
+  optimize(scale, src, new Float64Array(64), 64);
+  src_rab.resize(37 * 8);
+  let dst = new Float64Array(64);
+  scale(src, dst, 64);
+  for (let i = 0; i < 37; i++) assertEquals(src[i] * 2, dst[i]);
+  for (let i = 37; i < 64; i++) assertEquals(NaN, dst[i]);
+})();
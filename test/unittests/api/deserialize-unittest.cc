@@ -515,7 +515,8 @@ class MergeDeserializedCodeTest : public DeserializeTest {
                           ScriptObjectFlag retained_after_background_merge,
                           ScriptObjectFlag aged_after_background_merge,
                           bool lazy_should_be_compiled = false,
-                          bool eager_should_be_compiled = true) {
+                          bool eager_should_be_compiled = true,
+                          bool merge_incrementally = false) {
     i::v8_flags.merge_background_deserialized_script_with_compilation_cache =
         true;
     std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data;
@@ -596,6 +597,10 @@ class MergeDeserializedCodeTest : public DeserializeTest {
       MergeThread merge_thread(task.get());
       CHECK(merge_thread.Start());
       merge_thread.Join();
+      if (merge_incrementally) {
+        // Merge a single function before running code, the rest afterwards.
+        task->ContinueMergeInForeground(isolate(), 1);
+      }
     }
 
     if (run_code_after_background_merge) {
@@ -618,6 +623,17 @@ class MergeDeserializedCodeTest : public DeserializeTest {
                        i_isolate);
     }
 
+    if (merge_expected && merge_incrementally) {
+      while (!task->ContinueMergeInForeground(isolate(), 1)) {
+        if (run_code_after_background_merge) {
+          // Run the original script between all increments, so that they see
+          // infos the script gained or recompiled since the last increment.
+          CHECK(!original_script.Get(isolate())->Run(context()).IsEmpty());
+          CHECK_EQ(RunGlobalFunc("lazy"), v8::Integer::New(isolate(), 42));
+        }
+      }
+    }
+
     Global<Script> new_script;
     {
       ScriptCompiler::Source source(NewString(kSourceCode),
@@ -755,6 +771,33 @@ TEST_F(MergeDeserializedCodeTest, MainThreadReMerge) {
                      true);                  // lazy_should_be_compiled
 }
 
+TEST_F(MergeDeserializedCodeTest, MergeBasicIncrementally) {
+  TestOffThreadMerge(kEagerAndLazy,     // retained_before_background_merge
+                     kToplevelSfiFlag,  // aged_before_background_merge
+                     false,             // run_code_after_background_merge
+                     kNone,             // retained_after_background_merge
+                     kNone,             // aged_after_background_merge
+                     false,             // lazy_should_be_compiled
+                     true,              // eager_should_be_compiled
+                     true);             // merge_incrementally
+}
+
+TEST_F(MergeDeserializedCodeTest, MainThreadReMergeIncrementally) {
+  // Like MainThreadReMerge, but the original script runs between all
+  // increments of the main-thread merge. The first run recreates the IIFE SFI
+  // after the first increment, so a later increment has to forward to it
+  // instead of the deserialized one. The final check that the new script
+  // reuses all live original objects covers that re-merge.
+  TestOffThreadMerge(kToplevelEagerAndLazy,  // retained_before_background_merge
+                     kToplevelAndEager,      // aged_before_background_merge
+                     true,                   // run_code_after_background_merge
+                     kAllScriptObjects,      // retained_after_background_merge
+                     kToplevelSfiFlag,       // aged_after_background_merge
+                     true,                   // lazy_should_be_compiled
+                     true,                   // eager_should_be_compiled
+                     true);                  // merge_incrementally
+}
+
 TEST_F(MergeDeserializedCodeTest, Regress1360024) {
   // This test case triggers a re-merge on the main thread, similar to
   // MainThreadReMerge. However, it does not retain the lazy function's SFI at
@@ -13,8 +13,13 @@
 #include "testing/gtest/include/gtest/gtest.h"
 
 #ifdef V8_TARGET_OS_LINUX
+#include <stdlib.h>
+#include <sys/stat.h>
 #include <sys/sysmacros.h>
 
+#include <string>
+#include <vector>
+
 #include "src/base/platform/platform-linux.h"
 #include "src/base/virtual-address-space.h"
 #endif
@@ -57,6 +62,13 @@ TEST(OS, GetCurrentProcessId) {
 #endif
 }
 
+TEST(OS, HugePageSize) {
+  const size_t huge_page_size = OS::HugePageSize();
+  if (huge_page_size == 0) return;
+  EXPECT_GT(huge_page_size, OS::CommitPageSize());
+  EXPECT_EQ(0u, huge_page_size & (huge_page_size - 1));
+}
+
 TEST(OS, RemapPages) {
   if constexpr (OS::IsRemapPageSupported()) {
     const size_t size = base::OS::AllocatePageSize();
@@ -268,6 +280,101 @@ TEST(OS, SignalSafeMapsParserCustomName) {
   }
   EXPECT_TRUE(found);
 }
+
+namespace {
+
+// A fake cgroup2 and procfs layout in a temporary directory.
+class FakeCgroupRoot {
+ public:
+  FakeCgroupRoot() {
+    char root[] = "/tmp/v8_fake_cgroup_XXXXXX";
+    CHECK_NOT_NULL(mkdtemp(root));
+    root_ = root;
+    MakeDirectory("/proc");
+    MakeDirectory("/proc/self");
+    MakeDirectory("/proc/pressure");
+    MakeDirectory("/cgroup");
+  }
+  ~FakeCgroupRoot() {
+    for (auto it = files_.rbegin(); it != files_.rend(); ++it) {
+      CHECK_EQ(0, remove(it->c_str()));
+    }
+    CHECK_EQ(0, remove(root_.c_str()));
+  }
+
+  std::string cgroup_root() const { return root_ + "/cgroup"; }
+  std::string proc_root() const { return root_ + "/proc"; }
+
+  void MakeDirectory(const std::string& path) {
+    const std::string full_path = root_ + path;
+    CHECK_EQ(0, mkdir(full_path.c_str(), 0700));
+    files_.push_back(full_path);
+  }
+
+  void WriteFile(const std::string& path, const char* content) {
+    const std::string full_path = root_ + path;
+    FILE* file = fopen(full_path.c_str(), "w");
+    CHECK_NOT_NULL(file);
+    fputs(content, file);
+    fclose(file);
+    files_.push_back(full_path);
+  }
+
+ private:
+  std::string root_;
+  // Files and directories in creation order.
+  std::vector<std::string> files_;
+};
+
+}  // namespace
+
+TEST(OS, ContainerMemoryInfoWithoutCgroupV2) {
+  FakeCgroupRoot root;
+  root.WriteFile("/proc/self/cgroup", "4:memory:/job\n");
+  OS::ContainerMemoryInfo info =
+      ReadContainerMemoryInfo(root.cgroup_root(), root.proc_root());
+  EXPECT_FALSE(info.limit);
+  EXPECT_FALSE(info.usage);
+  EXPECT_FALSE(info.stall_percent);
+}
+
+TEST(OS, ContainerMemoryInfoUsesSmallestAncestorLimit) {
+  FakeCgroupRoot root;
+  root.WriteFile("/proc/self/cgroup", "1:cpu:/\n0::/job/task\n");
+  root.MakeDirectory("/cgroup/job");
+  root.MakeDirectory("/cgroup/job/task");
+  root.WriteFile("/cgroup/job/memory.max", "1073741824\n");
+  root.WriteFile("/cgroup/job/task/memory.max", "max\n");
+  root.WriteFile("/cgroup/job/task/memory.current", "536870912\n");
+  root.WriteFile("/proc/pressure/memory",
+                 "some avg10=12.50 avg60=3.00 avg300=1.00 total=1234\n"
+                 "full avg10=0.00 avg60=0.00 avg300=0.00 total=0\n");
+  OS::ContainerMemoryInfo info =
+      ReadContainerMemoryInfo(root.cgroup_root(), root.proc_root());
+  ASSERT_TRUE(info.limit);
+  EXPECT_EQ(uint64_t{1} * 1024 * 1024 * 1024, *info.limit);
+  ASSERT_TRUE(info.usage);
+  EXPECT_EQ(uint64_t{512} * 1024 * 1024, *info.usage);
+  ASSERT_TRUE(info.stall_percent);
+  EXPECT_DOUBLE_EQ(12.5, *info.stall_percent);
+}
+
+TEST(OS, ContainerMemoryInfoPrefersCgroupPressure) {
+  FakeCgroupRoot root;
+  root.WriteFile("/proc/self/cgroup", "0::/job\n");
+  root.MakeDirectory("/cgroup/job");
+  root.WriteFile("/cgroup/job/memory.max", "max\n");
+  root.WriteFile("/cgroup/job/memory.pressure",
+                 "some avg10=42.00 avg60=3.00 avg300=1.00 total=1234\n");
+  root.WriteFile("/proc/pressure/memory",
+                 "some avg10=1.00 avg60=3.00 avg300=1.00 total=1234\n");
+  OS::ContainerMemoryInfo info =
+      ReadContainerMemoryInfo(root.cgroup_root(), root.proc_root());
+  EXPECT_FALSE(info.limit);
+  EXPECT_FALSE(info.usage);
+  ASSERT_TRUE(info.stall_percent);
+  EXPECT_DOUBLE_EQ(42.0, *info.stall_percent);
+}
 #endif  // V8_TARGET_OS_LINUX
 
 namespace {
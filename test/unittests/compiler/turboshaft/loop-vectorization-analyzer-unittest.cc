@@ -0,0 +1,114 @@
+// Copyright 2026 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/vector.h"
+#include "src/compiler/turboshaft/assembler.h"
+#include "src/compiler/turboshaft/loop-vectorization-reducer.h"
+#include "src/compiler/turboshaft/operations.h"
+#include "src/compiler/turboshaft/representations.h"
+#include "test/unittests/compiler/turboshaft/reducer-test.h"
+
+namespace v8::internal::compiler::turboshaft {
+
+#include "src/compiler/turboshaft/define-assembler-macros.inc"
+
+class LoopVectorizationAnalyzerTest : public ReducerTest {};
+
+// The typed array accesses are raw loads from the (uniform) data pointer,
+// indexed by the zero-extended induction variable, as produced by the
+// lowering of JS typed array element loads.
+template <typename AssemblerT>
+OpIndex LoadElement(AssemblerT& Asm, V<WordPtr> data, V<Word32> index,
+                    MemoryRepresentation rep) {
+  return __ Load(data, __ ChangeUint32ToUintPtr(index),
+                 LoadOp::Kind::RawAligned().NotLoadEliminable(), rep, 0,
+                 rep.SizeInBytesLog2());
+}
+
+// for (let i = 0; i < length; i++) sum = (sum + a[i]) | 0;
+TEST_F(LoopVectorizationAnalyzerTest, Int32SumReduction) {
+  auto test = CreateFromGraph(
+      base::VectorOf({RegisterRepresentation::WordPtr(),
+                      RegisterRepresentation::Word32()}),
+      [](auto& Asm) {
+        using AssemblerT = std::remove_reference_t<decltype(Asm)>::assembler_t;
+        V<WordPtr> data = Asm.template GetParameter<WordPtr>(0);
+        V<Word32> length = Asm.template GetParameter<Word32>(1);
+
+        ScopedVar<Word32, AssemblerT> index(&Asm, 0);
+        ScopedVar<Word32, AssemblerT> sum(&Asm, 0);
+
+        WHILE(__ Int32LessThan(index, length)) {
+          V<Word32> value =
+              LoadElement(Asm, data, index, MemoryRepresentation::Int32());
+          sum = __ Word32Add(sum, value);
+          index = __ Word32Add(index, 1);
+        }
+
+        __ Return(sum);
+      });
+
+  LoopVectorizationAnalyzer analyzer(test.zone(), &test.graph());
+  EXPECT_TRUE(analyzer.CanVectorizeAtLeastOneLoop());
+}
+
+// for (let i = 0; i < length; i++) max = Math.max(max, a[i]);
+TEST_F(LoopVectorizationAnalyzerTest, Float64MaxReduction) {
+  auto test = CreateFromGraph(
+      base::VectorOf({RegisterRepresentation::WordPtr(),
+                      RegisterRepresentation::Word32()}),
+      [](auto& Asm) {
+        using AssemblerT = std::remove_reference_t<decltype(Asm)>::assembler_t;
+        V<WordPtr> data = Asm.template GetParameter<WordPtr>(0);
+        V<Word32> length = Asm.template GetParameter<Word32>(1);
+
+        ScopedVar<Word32, AssemblerT> index(&Asm, 0);
+        ScopedVar<Float64, AssemblerT> max(&Asm, __ Float64Constant(0));
+
+        WHILE(__ Int32LessThan(index, length)) {
+          V<Float64> value =
+              LoadElement(Asm, data, index, MemoryRepresentation::Float64());
+          max = __ Float64Max(max, value);
+          index = __ Word32Add(index, 1);
+        }
+
+        __ Return(max);
+      });
+
+  LoopVectorizationAnalyzer analyzer(test.zone(), &test.graph());
+  EXPECT_TRUE(analyzer.CanVectorizeAtLeastOneLoop());
+}
+
+// for (let i = 0; i < length; i++) sum += a[i];
+// Floating-point additions are not associative, so summing the lanes
+// separately could change the result.
+TEST_F(LoopVectorizationAnalyzerTest, Float64SumReductionIsNotVectorized) {
+  auto test = CreateFromGraph(
+      base::VectorOf({RegisterRepresentation::WordPtr(),
+                      RegisterRepresentation::Word32()}),
+      [](auto& Asm) {
+        using AssemblerT = std::remove_reference_t<decltype(Asm)>::assembler_t;
+        V<WordPtr> data = Asm.template GetParameter<WordPtr>(0);
+        V<Word32> length = Asm.template GetParameter<Word32>(1);
+
+        ScopedVar<Word32, AssemblerT> index(&Asm, 0);
+        ScopedVar<Float64, AssemblerT> sum(&Asm, __ Float64Constant(0));
+
+        WHILE(__ Int32LessThan(index, length)) {
+          V<Float64> value =
+              LoadElement(Asm, data, index, MemoryRepresentation::Float64());
+          sum = __ Float64Add(sum, value);
+          index = __ Word32Add(index, 1);
+        }
+
+        __ Return(sum);
+      });
+
+  LoopVectorizationAnalyzer analyzer(test.zone(), &test.graph());
+  EXPECT_FALSE(analyzer.CanVectorizeAtLeastOneLoop());
+}
+
+#include "src/compiler/turboshaft/undef-assembler-macros.inc"
+
+}  // namespace v8::internal::compiler::turboshaft
@@ -304,6 +304,49 @@ TEST(WorkListTest, MultipleSegmentsStolen) {
   EXPECT_TRUE(worklist.IsEmpty());
 }
 
+TEST(WorkListTest, ShareWorkPublishesPushSegment) {
+  TestWorklist worklist;
+  TestWorklist::Local worklist_local1(worklist);
+  TestWorklist::Local worklist_local2(worklist);
+  SomeObject dummy;
+  SomeObject* retrieved = nullptr;
+  EXPECT_FALSE(worklist_local1.ShareWorkIfGlobalEmpty());
+  worklist_local1.Push(&dummy);
+  EXPECT_TRUE(worklist_local1.ShareWorkIfGlobalEmpty());
+  EXPECT_EQ(1U, worklist.Size());
+  EXPECT_TRUE(worklist_local1.IsLocalEmpty());
+  // The global worklist is not empty anymore.
+  worklist_local1.Push(&dummy);
+  EXPECT_FALSE(worklist_local1.ShareWorkIfGlobalEmpty());
+  EXPECT_TRUE(worklist_local2.Pop(&retrieved));
+  EXPECT_EQ(&dummy, retrieved);
+  EXPECT_TRUE(worklist_local1.Pop(&retrieved));
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
+TEST(WorkListTest, ShareWorkSplitsPopSegment) {
+  TestWorklist worklist;
+  TestWorklist::Local worklist_local1(worklist);
+  TestWorklist::Local worklist_local2(worklist);
+  SomeObject dummy;
+  SomeObject* retrieved = nullptr;
+  for (size_t i = 0; i < TestWorklist::kMinSegmentSize; i++) {
+    worklist_local1.Push(&dummy);
+  }
+  // Moves the push segment into the pop segment.
+  EXPECT_TRUE(worklist_local1.Pop(&retrieved));
+  EXPECT_TRUE(worklist_local1.ShareWorkIfGlobalEmpty());
+  EXPECT_EQ(1U, worklist.Size());
+  // The second view steals the split off half.
+  size_t popped_local2 = 0;
+  while (worklist_local2.Pop(&retrieved)) popped_local2++;
+  EXPECT_EQ((TestWorklist::kMinSegmentSize - 1) / 2, popped_local2);
+  size_t popped_local1 = 0;
+  while (worklist_local1.Pop(&retrieved)) popped_local1++;
+  EXPECT_EQ(TestWorklist::kMinSegmentSize - 1, popped_local1 + popped_local2);
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 TEST(WorkListTest, MergeGlobalPool) {
   TestWorklist worklist1;
   TestWorklist::Local worklist_local1(worklist1);
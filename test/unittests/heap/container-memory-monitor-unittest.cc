@@ -0,0 +1,119 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/container-memory-monitor.h"
+
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+
+// A multiple of 100 so that usage percentages below are exact.
+constexpr uint64_t kContainerLimit = uint64_t{1000} * MB;
+
+int provider_calls = 0;
+
+base::OS::ContainerMemoryInfo NoContainer() {
+  provider_calls++;
+  return {};
+}
+
+base::OS::ContainerMemoryInfo HalfFullContainer() {
+  provider_calls++;
+  return {kContainerLimit, kContainerLimit / 2, 0.0};
+}
+
+base::OS::ContainerMemoryInfo Usage(uint64_t usage) {
+  return {kContainerLimit, usage, std::nullopt};
+}
+
+uint64_t current_usage = 0;
+
+base::OS::ContainerMemoryInfo CurrentUsage() { return Usage(current_usage); }
+
+}  // namespace
+
+TEST(ContainerMemoryMonitorTest, NoPressureWithoutContainer) {
+  EXPECT_EQ(MemoryPressureLevel::kNone,
+            ContainerMemoryMonitor::ComputePressureLevel({}));
+}
+
+TEST(ContainerMemoryMonitorTest, PressureFromUsage) {
+  FLAG_VALUE_SCOPE(container_memory_pressure_percent, 80);
+  EXPECT_EQ(MemoryPressureLevel::kNone,
+            ContainerMemoryMonitor::ComputePressureLevel(
+                Usage(kContainerLimit * 79 / 100)));
+  EXPECT_EQ(MemoryPressureLevel::kModerate,
+            ContainerMemoryMonitor::ComputePressureLevel(
+                Usage(kContainerLimit * 80 / 100)));
+  EXPECT_EQ(MemoryPressureLevel::kModerate,
+            ContainerMemoryMonitor::ComputePressureLevel(
+                Usage(kContainerLimit * 89 / 100)));
+  EXPECT_EQ(MemoryPressureLevel::kCritical,
+            ContainerMemoryMonitor::ComputePressureLevel(
+                Usage(kContainerLimit * 90 / 100)));
+  EXPECT_EQ(MemoryPressureLevel::kCritical,
+            ContainerMemoryMonitor::ComputePressureLevel(
+                Usage(kContainerLimit)));
+}
+
+TEST(ContainerMemoryMonitorTest, PressureFromStalls) {
+  FLAG_VALUE_SCOPE(container_memory_stall_percent, 5.0);
+  base::OS::ContainerMemoryInfo info;
+  info.stall_percent = 4.9;
+  EXPECT_EQ(MemoryPressureLevel::kNone,
+            ContainerMemoryMonitor::ComputePressureLevel(info));
+  info.stall_percent = 5.0;
+  EXPECT_EQ(MemoryPressureLevel::kModerate,
+            ContainerMemoryMonitor::ComputePressureLevel(info));
+}
+
+TEST(ContainerMemoryMonitorTest, CapMaxOldGenerationSize) {
+  FLAG_VALUE_SCOPE(container_heap_limit_percent, 50);
+  ContainerMemoryMonitor no_container(&NoContainer);
+  EXPECT_EQ(size_t{4} * GB,
+            no_container.CapMaxOldGenerationSize(size_t{4} * GB));
+  ContainerMemoryMonitor monitor(&HalfFullContainer);
+  EXPECT_EQ(kContainerLimit / 2,
+            monitor.CapMaxOldGenerationSize(size_t{4} * GB));
+  EXPECT_EQ(size_t{256} * MB,
+            monitor.CapMaxOldGenerationSize(size_t{256} * MB));
+}
+
+TEST(ContainerMemoryMonitorTest, SamplingIsRateLimited) {
+  FLAG_VALUE_SCOPE(container_memory_sampling_interval_ms, 100);
+  FLAG_VALUE_SCOPE(container_memory_pressure_percent, 50);
+  ContainerMemoryMonitor monitor(&HalfFullContainer);
+  provider_calls = 0;
+  EXPECT_EQ(MemoryPressureLevel::kModerate, monitor.Sample(1000));
+  EXPECT_EQ(1, provider_calls);
+  EXPECT_EQ(MemoryPressureLevel::kNone, monitor.Sample(1099));
+  EXPECT_EQ(1, provider_calls);
+  monitor.Sample(1100);
+  EXPECT_EQ(2, provider_calls);
+}
+
+TEST(ContainerMemoryMonitorTest, OnlyRisingPressureIsReported) {
+  FLAG_VALUE_SCOPE(container_memory_sampling_interval_ms, 0);
+  FLAG_VALUE_SCOPE(container_memory_pressure_percent, 50);
+  ContainerMemoryMonitor monitor(&CurrentUsage);
+  current_usage = kContainerLimit / 2;
+  EXPECT_EQ(MemoryPressureLevel::kModerate, monitor.Sample(0));
+  // Sustained pressure is only reported once.
+  EXPECT_EQ(MemoryPressureLevel::kNone, monitor.Sample(1));
+  current_usage = kContainerLimit;
+  EXPECT_EQ(MemoryPressureLevel::kCritical, monitor.Sample(2));
+  EXPECT_EQ(MemoryPressureLevel::kNone, monitor.Sample(3));
+  current_usage = kContainerLimit / 2;
+  EXPECT_EQ(MemoryPressureLevel::kNone, monitor.Sample(4));
+  // Pressure that went away and comes back is reported again.
+  current_usage = 0;
+  EXPECT_EQ(MemoryPressureLevel::kNone, monitor.Sample(5));
+  current_usage = kContainerLimit / 2;
+  EXPECT_EQ(MemoryPressureLevel::kModerate, monitor.Sample(6));
+}
+
+}  // namespace v8::internal
@@ -15,6 +15,7 @@
 #include "src/heap/cppgc-internal/heap-object-header.h"
 #include "src/heap/cppgc-internal/heap-visitor.h"
 #include "src/heap/cppgc-internal/heap.h"
+#include "src/heap/cppgc-internal/stats-collector.h"
 #include "test/unittests/heap/cppgc/tests.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -681,6 +682,25 @@ TEST_F(MinorGCTest, ReexecuteCustomCallback) {
   EXPECT_EQ(4u, GCedWithCustomWeakCallback::custom_callback_called);
 }
 
+TEST_F(MinorGCTest, StatsCollectorReportsYoungGenerationStats) {
+  Persistent<Small> old = MakeGarbageCollected<Small>(GetAllocationHandle());
+  CollectMinor();
+  EXPECT_TRUE(IsHeapObjectOld(old.Get()));
+
+  old->next = MakeGarbageCollected<Small>(GetAllocationHandle());
+  MakeGarbageCollected<Small>(GetAllocationHandle());
+  CollectMinor();
+
+  const StatsCollector::Event& event =
+      Heap::From(GetHeap())->stats_collector()->GetPreviousEventForTesting();
+  EXPECT_EQ(CollectionType::kMinor, event.collection_type);
+  EXPECT_EQ(1u, event.remembered_slots);
+  EXPECT_EQ(0u, event.remembered_source_objects);
+  // Only the object referenced from the old object survived.
+  EXPECT_LT(0u, event.marked_bytes);
+  EXPECT_LT(event.marked_bytes, event.young_object_size_before_sweep_bytes);
+}
+
 TEST_F(MinorGCTest, AgeTableIsReset) {
   using Type1 = SimpleGCed<16>;
   using Type2 = SimpleGCed<64>;
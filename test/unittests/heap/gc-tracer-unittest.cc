@@ -218,6 +218,24 @@ TEST_F(GCTracerTest, IncrementalScope) {
             tracer->current_.scopes[GCTracer::Scope::MC_INCREMENTAL]);
 }
 
+TEST_F(GCTracerTest, DeferredCompaction) {
+  if (v8_flags.stress_incremental_marking) return;
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  tracer->ResetForTesting();
+
+  // 1 MB/ms compaction speed.
+  tracer->AddCompactionEvent(10, 10 * MB);
+  StartTracing(tracer, GarbageCollector::MARK_COMPACTOR,
+               StartTracingMode::kAtomic);
+  EXPECT_EQ(base::TimeDelta(), tracer->EstimatedDeferredCompactionDuration());
+  tracer->AddDeferredCompaction(2 * MB);
+  tracer->AddDeferredCompaction(1 * MB);
+  EXPECT_EQ(3 * MB, tracer->current_.deferred_compaction_bytes);
+  EXPECT_EQ(base::TimeDelta::FromMilliseconds(3),
+            tracer->EstimatedDeferredCompactionDuration());
+  StopTracing(i_isolate()->heap(), GarbageCollector::MARK_COMPACTOR);
+}
+
 TEST_F(GCTracerTest, IncrementalMarkingDetails) {
   if (v8_flags.stress_incremental_marking) return;
   GCTracer* tracer = i_isolate()->heap()->tracer();
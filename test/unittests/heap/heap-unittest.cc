@@ -4,6 +4,7 @@
 
 #include "src/heap/heap.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstdint>
 #include <cstdio>
@@ -23,6 +24,7 @@
 #include "include/v8-initialization.h"
 #include "include/v8-isolate.h"
 #include "include/v8-object.h"
+#include "include/v8-statistics.h"
 #include "src/base/bounded-page-allocator.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/compilation-cache.h"
@@ -38,9 +40,12 @@
 #include "src/heap/heap-layout-inl.h"
 #include "src/heap/heap-layout.h"
 #include "src/heap/main-allocator-inl.h"
+#include "src/heap/mark-compact.h"
 #include "src/heap/marking-state-inl.h"
+#include "src/heap/memory-allocator.h"
 #include "src/heap/minor-mark-sweep.h"
 #include "src/heap/mutable-page.h"
+#include "src/heap/paged-spaces.h"
 #include "src/heap/remembered-set.h"
 #include "src/heap/safepoint.h"
 #include "src/heap/spaces-inl.h"
@@ -57,6 +62,7 @@
 #include "src/objects/transitions-inl.h"
 #include "src/regexp/regexp.h"
 #include "src/sandbox/external-pointer-table.h"
+#include "test/common/flag-utils.h"
 #include "test/common/noop-bytecode-verifier.h"
 #include "test/unittests/heap/heap-utils.h"
 #include "test/unittests/test-utils.h"
@@ -352,6 +358,98 @@ TEST_F(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling) {
   EXPECT_GE(heap->external_memory_soft_limit(), kExternalAllocationSoftLimit);
 }
 
+TEST_F(HeapTest, FragmentationHistogramIsExposedInSpaceStatistics) {
+  if (v8_flags.single_generation) return;
+  // The histograms are only recorded by GCs that go on to compact.
+  v8_flags.compact = true;
+  v8_flags.compact_on_every_full_gc = true;
+  InvokeMajorGC();
+  InvokeMajorGC();
+  const PagedSpaceBase::FragmentationHistogram& histogram =
+      i_isolate()->heap()->old_space()->fragmentation_histogram();
+  v8::HeapSpaceStatistics space_statistics;
+  ASSERT_TRUE(v8_isolate()->GetHeapSpaceStatistics(&space_statistics,
+                                                   AllocationSpace::OLD_SPACE));
+  constexpr size_t kBuckets =
+      v8::HeapSpaceStatistics::kFragmentationHistogramBuckets;
+  size_t pages = 0;
+  for (size_t i = 0; i < kBuckets; i++) {
+    EXPECT_EQ(histogram[i], space_statistics.fragmentation_histogram(i));
+    pages += histogram[i];
+  }
+  EXPECT_LT(0u, pages);
+  EXPECT_EQ(0u, space_statistics.fragmentation_histogram(kBuckets));
+}
+
+TEST_F(HeapTest, CompactionBenefitPrefersFragmentedAndSparsePages) {
+  NormalPage::FragmentationStats fragmented;
+  fragmented.free_bytes = 64 * KB;
+  fragmented.fragmented_bytes = 64 * KB;
+  NormalPage::FragmentationStats usable;
+  usable.free_bytes = 64 * KB;
+  usable.fragmented_bytes = 0;
+  // Fragmented memory is worth more than memory that is still usable for
+  // allocation without compaction.
+  EXPECT_GT(MarkCompactCollector::CompactionBenefit(32 * KB, fragmented),
+            MarkCompactCollector::CompactionBenefit(32 * KB, usable));
+  // Pages with fewer live bytes are cheaper to evacuate.
+  EXPECT_GT(MarkCompactCollector::CompactionBenefit(16 * KB, usable),
+            MarkCompactCollector::CompactionBenefit(32 * KB, usable));
+  // Full pages don't free any memory.
+  EXPECT_EQ(0.0, MarkCompactCollector::CompactionBenefit(
+                     64 * KB, NormalPage::FragmentationStats()));
+}
+
+TEST_F(HeapTest, SortPagesByCompactionBenefit) {
+  ManualGCScope manual_gc_scope(isolate());
+  Heap* heap = i_isolate()->heap();
+  {
+    // Leave some free memory behind on the old space pages.
+    HandleScope scope(i_isolate());
+    for (int i = 0; i < 64; i++) {
+      i_isolate()->factory()->NewFixedArray(1024, AllocationType::kOld);
+    }
+  }
+  InvokeAtomicMajorGC();
+
+  NormalPage* page_with_free_memory = nullptr;
+  std::vector<std::pair<size_t, NormalPage*>> pages;
+  size_t live_bytes = 0;
+  for (NormalPage* page : *heap->old_space()) {
+    if (!page_with_free_memory &&
+        page->ComputeFragmentationStats().free_bytes > 0) {
+      page_with_free_memory = page;
+    }
+    // Assign increasing live bytes, so that the order of the pages changes
+    // unless their benefit happens to be ordered the same way.
+    pages.emplace_back(live_bytes, page);
+    live_bytes += 4 * KB;
+  }
+  ASSERT_NE(nullptr, page_with_free_memory);
+
+  std::vector<std::pair<size_t, NormalPage*>> sorted_pages = pages;
+  MarkCompactCollector::SortPagesByCompactionBenefit(&sorted_pages);
+  ASSERT_EQ(pages.size(), sorted_pages.size());
+  EXPECT_TRUE(
+      std::is_permutation(pages.begin(), pages.end(), sorted_pages.begin()));
+  for (size_t i = 1; i < sorted_pages.size(); i++) {
+    EXPECT_GE(MarkCompactCollector::CompactionBenefit(
+                  sorted_pages[i - 1].first,
+                  sorted_pages[i - 1].second->ComputeFragmentationStats()),
+              MarkCompactCollector::CompactionBenefit(
+                  sorted_pages[i].first,
+                  sorted_pages[i].second->ComputeFragmentationStats()));
+  }
+
+  // With the same fragmentation, the page that is cheaper to evacuate comes
+  // first.
+  std::vector<std::pair<size_t, NormalPage*>> same_page = {
+      {32 * KB, page_with_free_memory}, {0, page_with_free_memory}};
+  MarkCompactCollector::SortPagesByCompactionBenefit(&same_page);
+  EXPECT_EQ(0u, same_page[0].first);
+  EXPECT_EQ(size_t{32 * KB}, same_page[1].first);
+}
+
 #ifdef V8_COMPRESS_POINTERS
 TEST_F(HeapTest, HeapLayout) {
   // Produce some garbage.
@@ -885,6 +983,79 @@ TEST_F(HeapTest, ContainsSlow) {
   CHECK(!heap->lo_space()->ContainsSlow(0));
 }
 
+namespace {
+
+// Allocates a large object that dies right away and runs a full GC. Returns
+// with major sweeping still in progress.
+void CollectDeadLargePage(HeapTest* test) {
+  Isolate* iso = test->i_isolate();
+  Heap* heap = iso->heap();
+  MemoryAllocator* allocator = heap->memory_allocator();
+  if (heap->sweeping_in_progress()) {
+    heap->EnsureSweepingCompleted(
+        Heap::SweepingForcedFinalizationMode::kUnifiedHeap,
+        CompleteSweepingReason::kTesting);
+  }
+  ASSERT_EQ(0u, allocator->QueuedLargePagesCount());
+
+  {
+    HandleScope scope(iso);
+    DirectHandle<FixedArray> large_arr = iso->factory()->NewFixedArray(
+        kMaxRegularHeapObjectSize + 1, AllocationType::kOld);
+    CHECK(heap->lo_space()->Contains(*large_arr));
+  }
+  const size_t size_before_gc = allocator->Size();
+  {
+    DisableConservativeStackScanningScopeForTesting no_stack_scanning(heap);
+    test->InvokeMajorGC();
+  }
+  // The page is accounted as freed right away.
+  EXPECT_LE(allocator->Size() + kMaxRegularHeapObjectSize, size_before_gc);
+  ASSERT_TRUE(heap->major_sweeping_in_progress());
+}
+
+}  // namespace
+
+TEST_F(HeapTest, DeadLargePagesAreReleasedWhenSweepingCompletes) {
+  FLAG_SCOPE(concurrent_large_page_release);
+  // Without concurrent sweeping nothing releases the queued pages before
+  // sweeping is completed on the main thread.
+  FLAG_VALUE_SCOPE(concurrent_sweeping, false);
+  ManualGCScope manual_gc_scope(i_isolate());
+  Heap* heap = i_isolate()->heap();
+  MemoryAllocator* allocator = heap->memory_allocator();
+  CollectDeadLargePage(this);
+  if (HasFatalFailure()) return;
+  EXPECT_LT(0u, allocator->QueuedLargePagesCount());
+  heap->EnsureSweepingCompleted(
+      Heap::SweepingForcedFinalizationMode::kUnifiedHeap,
+      CompleteSweepingReason::kTesting);
+  EXPECT_EQ(0u, allocator->QueuedLargePagesCount());
+}
+
+TEST_F(HeapTest, DeadLargePagesAreReleasedBySweeperTasks) {
+  FLAG_SCOPE(concurrent_large_page_release);
+  FLAG_SCOPE(concurrent_sweeping);
+  ManualGCScope manual_gc_scope(i_isolate());
+  Heap* heap = i_isolate()->heap();
+  MemoryAllocator* allocator = heap->memory_allocator();
+  CollectDeadLargePage(this);
+  if (HasFatalFailure()) return;
+  if (!heap->sweeper()->UsingMajorSweeperTasks()) {
+    GTEST_SKIP() << "No sweeper tasks were posted";
+  }
+  // The sweeper job stays active as long as there are queued pages.
+  while (heap->sweeper()->AreMajorSweeperTasksRunning()) {
+    base::OS::Sleep(base::TimeDelta::FromMilliseconds(1));
+  }
+  // The pages were released without the main thread completing sweeping.
+  EXPECT_TRUE(heap->major_sweeping_in_progress());
+  EXPECT_EQ(0u, allocator->QueuedLargePagesCount());
+  heap->EnsureSweepingCompleted(
+      Heap::SweepingForcedFinalizationMode::kUnifiedHeap,
+      CompleteSweepingReason::kTesting);
+}
+
 TEST_F(HeapTest, ReadOnlySpaceContainsSlowRejectsAddressPastAreaEnd) {
   // After ShrinkToHighWaterMark, memory past area_end is decommitted,
   // so reporting it as "contained" simply because it's within the chunk
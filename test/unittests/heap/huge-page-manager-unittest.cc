@@ -0,0 +1,96 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/huge-page-manager.h"
+
+#include <cstring>
+
+#include "src/base/platform/platform.h"
+#include "src/heap/normal-page.h"
+#include "src/utils/allocation.h"
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+
+class HugePageRegion final {
+ public:
+  explicit HugePageRegion(size_t huge_page_size)
+      : size_(huge_page_size),
+        base_(GetPlatformPageAllocator()->AllocatePages(
+            nullptr, huge_page_size, huge_page_size,
+            PageAllocator::kReadWrite)) {
+    CHECK_NOT_NULL(base_);
+    // Collapsing requires the memory to be populated.
+    memset(base_, 0xab, size_);
+  }
+  ~HugePageRegion() {
+    CHECK(GetPlatformPageAllocator()->FreePages(base_, size_));
+  }
+
+  Address address() const { return reinterpret_cast<Address>(base_); }
+
+ private:
+  const size_t size_;
+  void* const base_;
+};
+
+}  // namespace
+
+TEST(HugePageManagerTest, DisabledByDefault) {
+  EXPECT_EQ(nullptr, HugePageManager::MaybeCreate());
+}
+
+TEST(HugePageManagerTest, MaybeCreateRequiresOSSupport) {
+  FLAG_SCOPE(huge_pages);
+  std::unique_ptr<HugePageManager> manager = HugePageManager::MaybeCreate();
+  if (base::OS::HugePageSize() == 0 ||
+      base::OS::HugePageSize() % NormalPage::kPageSize != 0) {
+    EXPECT_EQ(nullptr, manager);
+    return;
+  }
+  ASSERT_NE(nullptr, manager);
+  EXPECT_EQ(base::OS::HugePageSize(), manager->huge_page_size());
+  EXPECT_EQ(0u, manager->huge_page_backed_bytes());
+}
+
+TEST(HugePageManagerTest, FreeingChunkSplitsCollapsedRegion) {
+  const size_t huge_page_size = base::OS::HugePageSize();
+  if (huge_page_size == 0 || huge_page_size % NormalPage::kPageSize != 0) {
+    GTEST_SKIP() << "Huge pages are not supported";
+  }
+  HugePageManager manager(huge_page_size);
+  HugePageRegion region(huge_page_size);
+  manager.NotifyChunkAllocated(region.address(), huge_page_size);
+  if (!manager.TryCollapseRegion(region.address())) {
+    GTEST_SKIP() << "The OS rejected collapsing the region";
+  }
+  EXPECT_EQ(huge_page_size, manager.huge_page_backed_bytes());
+
+  manager.NotifyChunkFreed(region.address() + NormalPage::kPageSize,
+                           NormalPage::kPageSize, false);
+  EXPECT_EQ(0u, manager.huge_page_backed_bytes());
+}
+
+TEST(HugePageManagerTest, ReallocatingChunkAfterMemoryReduction) {
+  const size_t huge_page_size = base::OS::HugePageSize();
+  if (huge_page_size == 0 || huge_page_size % NormalPage::kPageSize != 0) {
+    GTEST_SKIP() << "Huge pages are not supported";
+  }
+  HugePageManager manager(huge_page_size);
+  HugePageRegion region(huge_page_size);
+  const Address chunk = region.address() + NormalPage::kPageSize;
+  manager.NotifyChunkFreed(chunk, NormalPage::kPageSize, true);
+  EXPECT_EQ(0u, manager.huge_page_backed_bytes());
+  // Allocating in the region opts it into huge pages again, which allows
+  // collapsing it.
+  manager.NotifyChunkAllocated(chunk, NormalPage::kPageSize);
+  if (manager.TryCollapseRegion(region.address())) {
+    EXPECT_EQ(huge_page_size, manager.huge_page_backed_bytes());
+  }
+}
+
+}  // namespace v8::internal
@@ -399,6 +399,31 @@ TEST_F(PoolTest, UnmapOnTeardown) {
   // Wait for the task to finish and disable rescheduling.
   pool()->ReenableTaskForTesting();
 }
+
+TEST_F(PoolTest, RefillPrefaultsAndDiscardsPages) {
+  MemoryPool pool(MemoryPool::Config{.timeout_in_sec = 0,
+                                     .max_prefaulted_pages = 4});
+  v8::PageAllocator* page_allocator = allocator()->data_page_allocator();
+
+  // Missing pages are allocated and faulted in, the target is capped.
+  pool.Refill(i_isolate(), page_allocator, 8);
+  EXPECT_EQ(4u, pool.GetCount(i_isolate()));
+  EXPECT_EQ(4u, pool.GetResidentCount(i_isolate()));
+
+  // Pages exceeding the target stay pooled but are discarded.
+  pool.Refill(i_isolate(), page_allocator, 1);
+  EXPECT_EQ(4u, pool.GetCount(i_isolate()));
+  EXPECT_EQ(1u, pool.GetResidentCount(i_isolate()));
+
+  // Discarded pages are faulted in again before new pages are allocated.
+  pool.Refill(i_isolate(), page_allocator, 3);
+  EXPECT_EQ(4u, pool.GetCount(i_isolate()));
+  EXPECT_EQ(3u, pool.GetResidentCount(i_isolate()));
+
+  pool.ReleaseImmediately(i_isolate());
+  EXPECT_EQ(0u, pool.GetCount(i_isolate()));
+  pool.TearDown();
+}
 #endif  // !V8_OS_FUCHSIA && !V8_ENABLE_SANDBOX
 
 }  // namespace internal
@@ -0,0 +1,67 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/pretenuring-handler.h"
+
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+TEST(AllocationSiteLifetimeTest, Empty) {
+  AllocationSiteLifetime lifetime;
+  EXPECT_EQ(0.0, lifetime.samples());
+  EXPECT_EQ(0.0, lifetime.FractionAtOrAbove(0.0));
+}
+
+TEST(AllocationSiteLifetimeTest, SamplesAreBucketedBySurvivalRatio) {
+  FLAG_VALUE_SCOPE(allocation_site_lifetime_decay, 1.0);
+  AllocationSiteLifetime lifetime;
+  lifetime.AddSample(0.0);
+  lifetime.AddSample(0.55);
+  lifetime.AddSample(0.8);
+  lifetime.AddSample(1.0);
+  EXPECT_EQ(1.0, lifetime.bucket(0));
+  EXPECT_EQ(1.0, lifetime.bucket(5));
+  EXPECT_EQ(1.0, lifetime.bucket(8));
+  EXPECT_EQ(1.0, lifetime.bucket(AllocationSiteLifetime::kBuckets - 1));
+  EXPECT_EQ(4.0, lifetime.samples());
+  EXPECT_DOUBLE_EQ(0.5, lifetime.FractionAtOrAbove(0.8));
+  EXPECT_DOUBLE_EQ(0.75, lifetime.FractionAtOrAbove(0.5));
+  EXPECT_DOUBLE_EQ(1.0, lifetime.FractionAtOrAbove(0.0));
+}
+
+TEST(AllocationSiteLifetimeTest, ThresholdWithinBucketIsInterpolated) {
+  FLAG_VALUE_SCOPE(allocation_site_lifetime_decay, 1.0);
+  AllocationSiteLifetime lifetime;
+  lifetime.AddSample(0.2);
+  lifetime.AddSample(0.3);
+  // Half of the samples in the [0.2, 0.3) bucket are assumed to be above 0.25.
+  EXPECT_DOUBLE_EQ(0.75, lifetime.FractionAtOrAbove(0.25));
+  EXPECT_DOUBLE_EQ(0.5, lifetime.FractionAtOrAbove(0.3));
+  EXPECT_DOUBLE_EQ(0.0, lifetime.FractionAtOrAbove(1.0));
+}
+
+TEST(AllocationSiteLifetimeTest, OldSamplesDecay) {
+  FLAG_VALUE_SCOPE(allocation_site_lifetime_decay, 0.5);
+  AllocationSiteLifetime lifetime;
+  lifetime.AddSample(1.0);
+  lifetime.AddSample(1.0);
+  EXPECT_DOUBLE_EQ(1.5, lifetime.samples());
+  lifetime.AddSample(0.0);
+  EXPECT_DOUBLE_EQ(1.75, lifetime.samples());
+  EXPECT_DOUBLE_EQ(0.75 / 1.75, lifetime.FractionAtOrAbove(0.8));
+}
+
+TEST(AllocationSiteLifetimeTest, WeightedSample) {
+  FLAG_VALUE_SCOPE(allocation_site_lifetime_decay, 1.0);
+  AllocationSiteLifetime lifetime;
+  lifetime.AddSample(0.9);
+  lifetime.AddSample(0.9);
+  lifetime.AddSample(0.1, lifetime.samples());
+  EXPECT_DOUBLE_EQ(4.0, lifetime.samples());
+  EXPECT_DOUBLE_EQ(0.5, lifetime.FractionAtOrAbove(0.8));
+}
+
+}  // namespace v8::internal
@@ -770,5 +770,64 @@ TEST_F(FeedbackVectorTest, DefineNamedOwnIC) {
   CHECK_EQ(InlineCacheState::MONOMORPHIC, nexus.ic_state());
 }
 
+TEST_F(FeedbackVectorTest, FeedbackProfileRoundTrip) {
+  if (!i::v8_flags.use_ic) return;
+  v8_flags.allow_natives_syntax = true;
+
+  // The same source is run in both isolates, but only warms up {f} in the
+  // first one, so that the feedback in the second one comes from the profile.
+  const char* source =
+      "function f(a, b) { return a + b; }"
+      "%EnsureFeedbackVectorForFunction(f);"
+      "if (globalThis.warm_up) { f(1.5, 2); f(0.5, 1); }";
+  std::vector<uint8_t> profile;
+  {
+    v8::HandleScope scope(v8_isolate());
+    TryRunJS("globalThis.warm_up = true;");
+    TryRunJS(source);
+    profile = v8_isolate()->CreateFeedbackProfile();
+  }
+
+  IsolateWrapper isolate_wrapper(kNoCounters);
+  v8::Isolate* isolate = isolate_wrapper.isolate();
+  v8::Isolate::Scope isolate_scope(isolate);
+  v8::HandleScope scope(isolate);
+  CHECK(isolate->LoadFeedbackProfile(profile.data(), profile.size()));
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  TryRunJS(isolate,
+           v8::String::NewFromUtf8(isolate, source).ToLocalChecked());
+
+  DirectHandle<JSFunction> f = Cast<JSFunction>(v8::Utils::OpenHandle(
+      *context->Global()
+           ->Get(context, v8::String::NewFromUtf8Literal(isolate, "f"))
+           .ToLocalChecked()));
+  Handle<FeedbackVector> feedback_vector(
+      f->feedback_vector(), reinterpret_cast<Isolate*>(isolate));
+  FeedbackVectorHelper helper(feedback_vector);
+  CHECK_SLOT_KIND(helper, 0, FeedbackSlotKind::kBinaryOp);
+  FeedbackNexus nexus(reinterpret_cast<Isolate*>(isolate), feedback_vector,
+                      helper.slot(0));
+  CHECK_EQ(BinaryOperationHint::kNumber, nexus.GetBinaryOperationFeedback());
+  CHECK_EQ(2, feedback_vector->invocation_count());
+}
+
+TEST_F(FeedbackVectorTest, FeedbackProfileRejectsMalformedData) {
+  v8::HandleScope scope(v8_isolate());
+  TryRunJS("function f(a, b) { return a + b; } f(1, 2);");
+  std::vector<uint8_t> profile = v8_isolate()->CreateFeedbackProfile();
+  CHECK(v8_isolate()->LoadFeedbackProfile(profile.data(), profile.size()));
+
+  // Truncated.
+  CHECK(!v8_isolate()->LoadFeedbackProfile(profile.data(),
+                                           profile.size() - 1));
+  // Corrupted.
+  profile.back() ^= 0xFF;
+  CHECK(!v8_isolate()->LoadFeedbackProfile(profile.data(), profile.size()));
+  // Not a profile at all.
+  const uint8_t garbage[] = {1, 2, 3, 4};
+  CHECK(!v8_isolate()->LoadFeedbackProfile(garbage, sizeof(garbage)));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,99 @@
+// Copyright 2025 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifdef V8_SNAPSHOT_COMPRESSION
+
+#include "src/snapshot/snapshot-compression.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "src/base/utils/random-number-generator.h"
+#include "test/common/flag-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8::internal {
+
+namespace {
+
+// Mostly repetitive data with some noise, similar to serialized heap objects.
+std::vector<uint8_t> CompressibleData(size_t size) {
+  base::RandomNumberGenerator rng(42);
+  std::vector<uint8_t> data(size);
+  for (size_t i = 0; i < size; i++) {
+    data[i] = rng.NextInt(16) == 0 ? static_cast<uint8_t>(rng.NextInt(256))
+                                   : static_cast<uint8_t>(i % 61);
+  }
+  return data;
+}
+
+std::vector<uint8_t> RandomData(size_t size) {
+  base::RandomNumberGenerator rng(42);
+  std::vector<uint8_t> data(size);
+  rng.NextBytes(data.data(), size);
+  return data;
+}
+
+void ExpectRoundTrip(const std::vector<uint8_t>& data,
+                     SnapshotCompressionCodec codec) {
+  SnapshotData uncompressed(base::VectorOf(data));
+  SnapshotData compressed = SnapshotCompression::Compress(&uncompressed, codec);
+  SnapshotData decompressed =
+      SnapshotCompression::Decompress(compressed.RawData());
+  ASSERT_EQ(data.size(), decompressed.RawData().size());
+  EXPECT_TRUE(std::equal(data.begin(), data.end(),
+                         decompressed.RawData().begin()));
+}
+
+}  // namespace
+
+TEST(SnapshotCompressionTest, CodecFromString) {
+  EXPECT_EQ(SnapshotCompressionCodec::kZlib,
+            SnapshotCompression::CodecFromString("zlib"));
+  EXPECT_EQ(SnapshotCompressionCodec::kLz,
+            SnapshotCompression::CodecFromString("lz"));
+  EXPECT_FALSE(SnapshotCompression::CodecFromString("lz4").has_value());
+}
+
+TEST(SnapshotCompressionTest, RoundTripSmallInputs) {
+  ExpectRoundTrip({}, SnapshotCompressionCodec::kLz);
+  for (SnapshotCompressionCodec codec :
+       {SnapshotCompressionCodec::kZlib, SnapshotCompressionCodec::kLz}) {
+    ExpectRoundTrip({1, 2, 3}, codec);
+    ExpectRoundTrip(std::vector<uint8_t>(100, 7), codec);
+  }
+}
+
+TEST(SnapshotCompressionTest, RoundTripCompressibleData) {
+  // Spans many blocks with a partial last block.
+  const std::vector<uint8_t> data = CompressibleData(1 * MB + 123);
+  ExpectRoundTrip(data, SnapshotCompressionCodec::kZlib);
+  ExpectRoundTrip(data, SnapshotCompressionCodec::kLz);
+  {
+    FLAG_VALUE_SCOPE(parallel_snapshot_decompression, false);
+    ExpectRoundTrip(data, SnapshotCompressionCodec::kLz);
+  }
+  SnapshotData uncompressed(base::VectorOf(data));
+  EXPECT_LT(SnapshotCompression::Compress(&uncompressed,
+                                          SnapshotCompressionCodec::kLz)
+                .RawData()
+                .size(),
+            data.size() / 2);
+}
+
+TEST(SnapshotCompressionTest, RoundTripIncompressibleData) {
+  const std::vector<uint8_t> data = RandomData(300 * KB);
+  ExpectRoundTrip(data, SnapshotCompressionCodec::kLz);
+  // Blocks that do not compress are stored, so the output barely grows.
+  SnapshotData uncompressed(base::VectorOf(data));
+  EXPECT_LT(SnapshotCompression::Compress(&uncompressed,
+                                          SnapshotCompressionCodec::kLz)
+                .RawData()
+                .size(),
+            data.size() + 64);
+}
+
+}  // namespace v8::internal
+
+#endif  // V8_SNAPSHOT_COMPRESSION
@@ -206,6 +206,8 @@ export const CATEGORIES = new Map([
   ],
   ['unclassified', new Set()],
   ['duplicated', new Set([
+      'CLEARED_TRANSITION_ARRAY_ENTRIES_TYPE',
+      'TRIMMED_DESCRIPTOR_ARRAY_ENTRIES_TYPE',
       'WASTED_DESCRIPTOR_ARRAY_DETAILS_TYPE',
       'WASTED_DESCRIPTOR_ARRAY_VALUES_TYPE',
     ])